@@ -25,7 +25,8 @@ public class NeoDataSync : ModuleRules
 			{
 				"Core",
 				"StructUtils",
-				"NetCore"
+				"NetCore",
+				"GameplayTags"
 			}
 			);
 			
@@ -36,7 +37,8 @@ public class NeoDataSync : ModuleRules
 				"CoreUObject",
 				"Engine",
 				"Slate",
-				"SlateCore"
+				"SlateCore",
+				"UMG"
 			}
 			);
 		
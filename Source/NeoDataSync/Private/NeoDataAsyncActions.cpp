@@ -0,0 +1,141 @@
+// Copyright 2025-2026 NeoNexus Studios. All Rights Reserved.
+
+#include "NeoDataAsyncActions.h"
+#include "Engine/World.h"
+#include "TimerManager.h"
+
+UNeoDataWaitForKeyAction* UNeoDataWaitForKeyAction::Create(UNeoReplicatedDataComponent* InComponent, const FRecordKey& InKey, float InTimeout)
+{
+	UNeoDataWaitForKeyAction* Action = NewObject<UNeoDataWaitForKeyAction>();
+	Action->Component = InComponent;
+	FRecordKey NormalizedKey;
+	Action->Key = InKey.Normalize(NormalizedKey);
+	Action->Timeout = InTimeout;
+	if (InComponent)
+	{
+		Action->RegisterWithGameInstance(InComponent);
+	}
+	return Action;
+}
+
+UNeoDataWaitForKeyAction* UNeoDataWaitForKeyAction::WaitForKey(UNeoReplicatedDataComponent* InComponent, const FRecordKey& InKey, float InTimeout)
+{
+	return Create(InComponent, InKey, InTimeout);
+}
+
+UNeoDataWaitForKeyAction* UNeoDataWaitForKeyAction::WaitForValueMatching(UNeoReplicatedDataComponent* InComponent, const FRecordKey& InKey, FNeoDataValuePredicate InPredicate, float InTimeout)
+{
+	UNeoDataWaitForKeyAction* Action = Create(InComponent, InKey, InTimeout);
+	Action->Predicate = InPredicate;
+	return Action;
+}
+
+void UNeoDataWaitForKeyAction::Activate()
+{
+	UNeoReplicatedDataComponent* Target = Component.Get();
+	if (!Target)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("[NeoDataSync] Wait For Key '%s' Failed: no component"), *Key.ToString());
+		Fail();
+		return;
+	}
+
+	if (TryCompleteFromMap())
+	{
+		return;
+	}
+
+	WatchHandle = Target->WatchKey(Key, FOnNeoDataKeyWatched::FDelegate::CreateUObject(this, &UNeoDataWaitForKeyAction::HandleKeyWatched));
+	Target->OnDataReset.AddDynamic(this, &UNeoDataWaitForKeyAction::HandleDataReset);
+	EndPlayHandle = Target->OnComponentEndPlay.AddUObject(this, &UNeoDataWaitForKeyAction::Fail);
+
+	if (Timeout > 0.0f)
+	{
+		if (UWorld* World = Target->GetWorld())
+		{
+			World->GetTimerManager().SetTimer(TimeoutHandle, FTimerDelegate::CreateUObject(this, &UNeoDataWaitForKeyAction::HandleTimeout), Timeout, false);
+		}
+	}
+}
+
+void UNeoDataWaitForKeyAction::Cancel()
+{
+	SetReadyToDestroy();
+}
+
+void UNeoDataWaitForKeyAction::SetReadyToDestroy()
+{
+	if (!bFinished)
+	{
+		bFinished = true;
+
+		if (UNeoReplicatedDataComponent* Target = Component.Get())
+		{
+			if (WatchHandle.IsValid())
+			{
+				Target->UnwatchKey(Key, WatchHandle);
+			}
+			Target->OnDataReset.RemoveDynamic(this, &UNeoDataWaitForKeyAction::HandleDataReset);
+			Target->OnComponentEndPlay.Remove(EndPlayHandle);
+
+			if (UWorld* World = Target->GetWorld())
+			{
+				World->GetTimerManager().ClearTimer(TimeoutHandle);
+			}
+		}
+		WatchHandle.Reset();
+		EndPlayHandle.Reset();
+	}
+
+	Super::SetReadyToDestroy();
+}
+
+bool UNeoDataWaitForKeyAction::TryComplete(const FRecordDefinition& Value)
+{
+	if (bFinished || (Predicate.IsBound() && !Predicate.Execute(Key, Value)))
+	{
+		return false;
+	}
+
+	// Copy first: OnFound handlers may change the map the value lives in
+	const FRecordDefinition Found = Value;
+	SetReadyToDestroy();
+	OnFound.Broadcast(Key, Found);
+	return true;
+}
+
+bool UNeoDataWaitForKeyAction::TryCompleteFromMap()
+{
+	const UNeoReplicatedDataComponent* Target = Component.Get();
+	const FRecordDefinition* Value = Target ? Target->DataMap.Find(Key) : nullptr;
+	return Value && TryComplete(*Value);
+}
+
+void UNeoDataWaitForKeyAction::HandleKeyWatched(const FRecordKey& ChangedKey, const FRecordDefinition& Value)
+{
+	TryComplete(Value);
+}
+
+void UNeoDataWaitForKeyAction::HandleDataReset()
+{
+	// BulkLoad and replay scrubs skip per-key notifications
+	TryCompleteFromMap();
+}
+
+void UNeoDataWaitForKeyAction::HandleTimeout()
+{
+	if (!bFinished)
+	{
+		SetReadyToDestroy();
+		OnTimedOut.Broadcast(Key, FRecordDefinition());
+	}
+}
+
+void UNeoDataWaitForKeyAction::Fail()
+{
+	if (!bFinished)
+	{
+		SetReadyToDestroy();
+		OnFailed.Broadcast(Key, FRecordDefinition());
+	}
+}
@@ -0,0 +1,216 @@
+// Copyright 2025-2026 NeoNexus Studios. All Rights Reserved.
+
+#include "NeoDataChangeStream.h"
+#include "NeoDataPayloadSerialization.h"
+#include "HAL/FileManager.h"
+#include "HAL/RunnableThread.h"
+
+void FNeoDataChangeRecord::LoadValue(FInstancedStruct& OutValue) const
+{
+	// Consumers drain off the game thread, where loading a package is not allowed
+	NeoDataPayloadSerialization::Load(ValueType, Payload, OutValue, /*bLoadObjects*/ false);
+}
+
+// ------------------------------------------------------------------------------------------------
+// FNeoDataChangeConsumer
+// ------------------------------------------------------------------------------------------------
+
+FNeoDataChangeConsumer::FNeoDataChangeConsumer(uint32 InCapacity)
+	// TCircularQueue holds one less than its buffer size
+	: Queue(FMath::Max<uint32>(InCapacity, 1) + 1)
+{
+}
+
+void FNeoDataChangeConsumer::Push(const FNeoDataChangeRecordPtr& Record)
+{
+	if (!Queue.Enqueue(Record))
+	{
+		Dropped.fetch_add(1, std::memory_order_relaxed);
+		return;
+	}
+
+	const uint32 Pending = Queue.Count();
+	if (Pending > HighWatermark.load(std::memory_order_relaxed))
+	{
+		HighWatermark.store(Pending, std::memory_order_relaxed);
+	}
+}
+
+int32 FNeoDataChangeConsumer::Drain(TFunctionRef<void(const FNeoDataChangeRecord&)> Visitor, int32 MaxRecords)
+{
+	int32 NumVisited = 0;
+	FNeoDataChangeRecordPtr Record;
+	while (NumVisited < MaxRecords && Queue.Dequeue(Record))
+	{
+		Visitor(*Record);
+		Record.Reset();
+		++NumVisited;
+	}
+	return NumVisited;
+}
+
+// ------------------------------------------------------------------------------------------------
+// FNeoDataChangeStream
+// ------------------------------------------------------------------------------------------------
+
+FNeoDataChangeConsumerRef FNeoDataChangeStream::AddConsumer(uint32 Capacity)
+{
+	check(IsInGameThread());
+	return Consumers.Add_GetRef(MakeShared<FNeoDataChangeConsumer, ESPMode::ThreadSafe>(Capacity));
+}
+
+void FNeoDataChangeStream::RemoveConsumer(const FNeoDataChangeConsumerRef& Consumer)
+{
+	check(IsInGameThread());
+	Consumers.Remove(Consumer);
+}
+
+void FNeoDataChangeStream::Publish(ENeoDataChangeOp Op, const FRecordKey& Key, const FRecordDefinition* Value, int64 Version, double Timestamp)
+{
+	if (Consumers.IsEmpty())
+	{
+		return;
+	}
+
+	// Built once and shared: consumers only ever read it
+	TSharedRef<FNeoDataChangeRecord, ESPMode::ThreadSafe> Record = MakeShared<FNeoDataChangeRecord, ESPMode::ThreadSafe>();
+	Record->Sequence = NextSequence++;
+	Record->Timestamp = Timestamp;
+	Record->Op = Op;
+	Record->Key = Key;
+	Record->Version = Version;
+	if (Value)
+	{
+		Record->ValueType = Value->Payload.GetScriptStruct();
+		NeoDataPayloadSerialization::Save(Value->Payload, Record->Payload);
+	}
+
+	const FNeoDataChangeRecordPtr Shared = Record;
+	for (const FNeoDataChangeConsumerRef& Consumer : Consumers)
+	{
+		Consumer->Push(Shared);
+	}
+}
+
+// ------------------------------------------------------------------------------------------------
+// FNeoDataChangeFileSink
+// ------------------------------------------------------------------------------------------------
+
+FNeoDataChangeFileSink::FNeoDataChangeFileSink(FNeoDataChangeConsumerRef InConsumer, const FString& InFilename)
+	: Consumer(MoveTemp(InConsumer))
+	, Filename(InFilename)
+{
+	File.Reset(IFileManager::Get().CreateFileWriter(*Filename, FILEWRITE_AllowRead));
+	if (File)
+	{
+		Thread = FRunnableThread::Create(this, TEXT("NeoDataChangeFileSink"), 0, TPri_BelowNormal);
+	}
+	else
+	{
+		UE_LOG(LogTemp, Warning, TEXT("[NeoDataSync] Change sink could not open '%s'"), *Filename);
+	}
+}
+
+FNeoDataChangeFileSink::~FNeoDataChangeFileSink()
+{
+	if (Thread)
+	{
+		// Kill(true) calls Stop and waits for Run to return
+		Thread->Kill(true);
+		delete Thread;
+		Thread = nullptr;
+	}
+
+	if (File)
+	{
+		DrainToFile();
+		File->Close();
+	}
+}
+
+uint32 FNeoDataChangeFileSink::Run()
+{
+	while (!bStopping)
+	{
+		DrainToFile();
+		FPlatformProcess::Sleep(0.05f);
+	}
+	return 0;
+}
+
+void FNeoDataChangeFileSink::DrainToFile()
+{
+	static const TCHAR* OpNames[] = { TEXT("Added"), TEXT("Updated"), TEXT("Removed") };
+
+	Consumer->Drain([this](const FNeoDataChangeRecord& Record)
+	{
+		const FString Line = FString::Printf(TEXT("%llu\t%.3f\t%s\t%lld\t%s\t%s\t%d\n"),
+			Record.Sequence,
+			Record.Timestamp,
+			OpNames[static_cast<uint8>(Record.Op)],
+			Record.Version,
+			*Record.Key.ToString(),
+			Record.ValueType ? *Record.ValueType->GetName() : TEXT("None"),
+			Record.Payload.Num());
+
+		const FTCHARToUTF8 Utf8(*Line);
+		File->Serialize(const_cast<ANSICHAR*>(Utf8.Get()), Utf8.Length());
+	});
+
+	File->Flush();
+}
+
+#if !UE_BUILD_SHIPPING
+
+#include "HAL/IConsoleManager.h"
+#include "Misc/Paths.h"
+#include "UObject/UObjectIterator.h"
+#include "GameFramework/Actor.h"
+
+namespace NeoDataChangeStream
+{
+	/** Sinks started from the console, by component. */
+	static TMap<TWeakObjectPtr<UNeoReplicatedDataComponent>, TPair<FNeoDataChangeConsumerRef, TUniquePtr<FNeoDataChangeFileSink>>> ConsoleSinks;
+}
+
+static FAutoConsoleCommand CmdNeoDataChangeSink(
+	TEXT("NeoData.ChangeSink"),
+	TEXT("Toggles a file sink on the change stream of every NeoData component owned by the named actor. Usage: NeoData.ChangeSink <ActorName> [Filename]"),
+	FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+	{
+		if (Args.IsEmpty())
+		{
+			UE_LOG(LogTemp, Display, TEXT("[NeoDataSync] Usage: NeoData.ChangeSink <ActorName> [Filename]"));
+			return;
+		}
+
+		for (TObjectIterator<UNeoReplicatedDataComponent> It; It; ++It)
+		{
+			UNeoReplicatedDataComponent* Component = *It;
+			const AActor* Owner = Component->GetOwner();
+			if (!Owner || Owner->GetName() != Args[0] || Component->HasAnyFlags(RF_ClassDefaultObject))
+			{
+				continue;
+			}
+
+			if (TPair<FNeoDataChangeConsumerRef, TUniquePtr<FNeoDataChangeFileSink>>* Existing = NeoDataChangeStream::ConsoleSinks.Find(Component))
+			{
+				UE_LOG(LogTemp, Display, TEXT("[NeoDataSync] Change sink stopped: %s (%llu dropped)"),
+					*Existing->Value->GetFilename(), Existing->Key->GetDroppedCount());
+				Component->GetChangeStream().RemoveConsumer(Existing->Key);
+				NeoDataChangeStream::ConsoleSinks.Remove(Component);
+				continue;
+			}
+
+			const FString Filename = Args.Num() > 1
+				? Args[1]
+				: FPaths::ProjectSavedDir() / TEXT("NeoData") / FString::Printf(TEXT("%s_%s_Changes.tsv"), *Owner->GetName(), *Component->GetName());
+
+			FNeoDataChangeConsumerRef Consumer = Component->GetChangeStream().AddConsumer();
+			TUniquePtr<FNeoDataChangeFileSink> Sink = MakeUnique<FNeoDataChangeFileSink>(Consumer, Filename);
+			UE_LOG(LogTemp, Display, TEXT("[NeoDataSync] Change sink started: %s"), *Filename);
+			NeoDataChangeStream::ConsoleSinks.Add(Component, { Consumer, MoveTemp(Sink) });
+		}
+	}));
+
+#endif // !UE_BUILD_SHIPPING
@@ -0,0 +1,61 @@
+// Copyright 2025-2026 NeoNexus Studios. All Rights Reserved.
+
+#include "NeoDataDefaultsAsset.h"
+#include "NeoDataStaticCache.h"
+#include "Hash/CityHash.h"
+
+#if WITH_EDITOR
+#include "UObject/ObjectSaveContext.h"
+#endif
+
+void UNeoDataDefaultsAsset::GetDefaults(TMap<FRecordKey, FRecordDefinition>& OutDefaults) const
+{
+	OutDefaults.Reserve(OutDefaults.Num() + Entries.Num());
+
+	for (const FNeoDataDefaultEntry& Entry : Entries)
+	{
+		if (!Entry.Key.IsValid() || Entry.Key.IsTransaction() || !Entry.Value.Payload.IsValid())
+		{
+			continue;
+		}
+
+		FRecordKey NormalizedKey;
+		OutDefaults.Add(Entry.Key.Normalize(NormalizedKey), Entry.Value);
+	}
+}
+
+#if WITH_EDITOR
+void UNeoDataDefaultsAsset::PreSave(FObjectPreSaveContext ObjectSaveContext)
+{
+	Super::PreSave(ObjectSaveContext);
+
+	const int32 NumBefore = Entries.Num();
+
+	// Bake: the cooked asset holds exactly what GetDefaults returns, in a stable order
+	TMap<FRecordKey, FRecordDefinition> Defaults;
+	GetDefaults(Defaults);
+
+	Entries.Reset(Defaults.Num());
+	for (TPair<FRecordKey, FRecordDefinition>& Pair : Defaults)
+	{
+		FNeoDataDefaultEntry& Entry = Entries.AddDefaulted_GetRef();
+		Entry.Key = MoveTemp(Pair.Key);
+		Entry.Value = MoveTemp(Pair.Value);
+	}
+
+	if (Entries.Num() != NumBefore)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("[NeoDataSync] %s: dropped %d invalid or duplicate default entries"), *GetPathName(), NumBefore - Entries.Num());
+	}
+
+	// Key and value text, so the hash matches across processes and changes with any struct layout change
+	uint64 Hash = 0;
+	for (const FNeoDataDefaultEntry& Entry : Entries)
+	{
+		const FString KeyText = Entry.Key.ToString();
+		Hash = CityHash64WithSeed(reinterpret_cast<const char*>(*KeyText), KeyText.Len() * sizeof(TCHAR), Hash);
+		Hash = CityHash128to64(Uint128_64(Hash, FNeoDataStaticCache::HashValue(Entry.Value.Payload)));
+	}
+	ContentHash = Hash;
+}
+#endif
@@ -0,0 +1,65 @@
+// Copyright 2025-2026 NeoNexus Studios. All Rights Reserved.
+
+#include "NeoDataDigest.h"
+#include "NeoReplicatedData.h"
+
+FNeoDataDigest::FNeoDataDigest(int32 InNumBuckets)
+	: NumBuckets(static_cast<int32>(FMath::RoundUpToPowerOfTwo(FMath::Clamp(InNumBuckets, 16, 65536))))
+{
+	Nodes.SetNumZeroed(NumBuckets * 2);
+}
+
+uint32 FNeoDataDigest::HashKey(const FRecordKey& Key)
+{
+	const uint32 KindHash = static_cast<uint32>(Key.Kind) + 1;
+	switch (Key.Kind)
+	{
+	case ENeoRecordKeyKind::Int:
+	case ENeoRecordKeyKind::Transaction:
+		return HashCombine(KindHash, GetTypeHash(Key.IntKey));
+	case ENeoRecordKeyKind::Guid:
+		return HashCombine(KindHash, GetTypeHash(Key.GuidKey));
+	default:
+		// Names compare case-insensitively
+		return HashCombine(KindHash, FCrc::StrCrc32(*Key.ToString().ToLower()));
+	}
+}
+
+uint64 FNeoDataDigest::HashEntry(uint32 KeyHash, int64 Version, bool bVolatile)
+{
+	// SplitMix64 finalizer: sums of well-mixed values rarely cancel, unlike sums of raw hashes
+	uint64 Hash = (static_cast<uint64>(KeyHash) << 32) ^ static_cast<uint64>(bVolatile ? 0 : Version);
+	Hash += 0x9E3779B97F4A7C15ull;
+	Hash = (Hash ^ (Hash >> 30)) * 0xBF58476D1CE4E5B9ull;
+	Hash = (Hash ^ (Hash >> 27)) * 0x94D049BB133111EBull;
+	return Hash ^ (Hash >> 31);
+}
+
+void FNeoDataDigest::Apply(int32 Bucket, uint64 Delta)
+{
+	for (int32 Node = NumBuckets + Bucket; Node >= 1; Node >>= 1)
+	{
+		Nodes[Node] += Delta;
+	}
+}
+
+void FNeoDataDigest::Reset()
+{
+	FMemory::Memzero(Nodes.GetData(), Nodes.Num() * sizeof(uint64));
+}
+
+void FNeoDataDigest::GetDescendants(int32 Node, int32 Depth, TArray<int32>& OutNodes) const
+{
+	int32 First = Node;
+	int32 Count = 1;
+	for (int32 Level = 0; Level < Depth && !IsLeaf(First); ++Level)
+	{
+		First *= 2;
+		Count *= 2;
+	}
+
+	for (int32 Index = 0; Index < Count; ++Index)
+	{
+		OutNodes.Add(First + Index);
+	}
+}
@@ -0,0 +1,109 @@
+// Copyright 2025-2026 NeoNexus Studios. All Rights Reserved.
+
+#include "NeoDataHistory.h"
+#include "NeoDataPayloadSerialization.h"
+
+FNeoDataHistory::FNeoDataHistory(int32 InCapacity)
+{
+	Records.SetNum(FMath::Max(InCapacity, 1));
+}
+
+FNeoDataHistoryRecord& FNeoDataHistory::Append(const FRecordKey& Key, double Timestamp)
+{
+	const uint64 Sequence = NextSequence++;
+	FNeoDataHistoryRecord& Record = Records[Sequence % Records.Num()];
+
+	// The overwritten record was its key's newest: that key has no history left
+	if (Sequence >= static_cast<uint64>(Records.Num()))
+	{
+		const uint64 OverwrittenSequence = Sequence - Records.Num();
+		const uint64* Latest = LatestByKey.Find(Record.Key);
+		if (Latest && *Latest == OverwrittenSequence)
+		{
+			LatestByKey.Remove(Record.Key);
+		}
+	}
+
+	uint64& Latest = LatestByKey.FindOrAdd(Key, MAX_uint64);
+
+	Record.Timestamp = Timestamp;
+	Record.Key = Key;
+	Record.ValueType = nullptr;
+	Record.Delta.Reset();
+	Record.PrevSequence = Latest;
+	Record.bRemoved = false;
+
+	Latest = Sequence;
+	return Record;
+}
+
+void FNeoDataHistory::RecordWrite(const FRecordKey& Key, const FInstancedStruct& Value, double Timestamp)
+{
+	FNeoDataHistoryRecord& Record = Append(Key, Timestamp);
+	Record.ValueType = Value.GetScriptStruct();
+	NeoDataPayloadSerialization::Save(Value, Record.Delta);
+}
+
+void FNeoDataHistory::RecordRemove(const FRecordKey& Key, double Timestamp)
+{
+	Append(Key, Timestamp).bRemoved = true;
+}
+
+bool FNeoDataHistory::FindValueAtTime(const FRecordKey& Key, double Time, FInstancedStruct& OutValue) const
+{
+	const uint64* Latest = LatestByKey.Find(Key);
+	if (!Latest)
+	{
+		return false;
+	}
+
+	for (uint64 Sequence = *Latest; IsLive(Sequence); )
+	{
+		const FNeoDataHistoryRecord& Record = Records[Sequence % Records.Num()];
+		if (Record.Timestamp > Time)
+		{
+			Sequence = Record.PrevSequence;
+			continue;
+		}
+
+		if (Record.bRemoved)
+		{
+			return false;
+		}
+
+		NeoDataPayloadSerialization::Load(Record.ValueType, Record.Delta, OutValue);
+		return true;
+	}
+
+	return false;
+}
+
+void FNeoDataHistory::ForEachRecord(const FRecordKey& Key, TFunctionRef<void(const FNeoDataHistoryRecord&)> Visitor) const
+{
+	const uint64* Latest = LatestByKey.Find(Key);
+	if (!Latest)
+	{
+		return;
+	}
+
+	for (uint64 Sequence = *Latest; IsLive(Sequence); )
+	{
+		const FNeoDataHistoryRecord& Record = Records[Sequence % Records.Num()];
+		Visitor(Record);
+		Sequence = Record.PrevSequence;
+	}
+}
+
+SIZE_T FNeoDataHistory::GetAllocatedSize() const
+{
+	SIZE_T Size = Records.GetAllocatedSize() + LatestByKey.GetAllocatedSize();
+	for (const FNeoDataHistoryRecord& Record : Records)
+	{
+		Size += Record.Delta.GetAllocatedSize() + FNeoStructTraits::GetAllocatedSize(Record.Key.KeyData);
+	}
+	for (const TPair<FRecordKey, uint64>& Pair : LatestByKey)
+	{
+		Size += FNeoStructTraits::GetAllocatedSize(Pair.Key.KeyData);
+	}
+	return Size;
+}
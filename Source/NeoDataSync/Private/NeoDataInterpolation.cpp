@@ -0,0 +1,83 @@
+// Copyright 2025-2026 NeoNexus Studios. All Rights Reserved.
+
+#include "NeoDataInterpolation.h"
+#include "UObject/UnrealType.h"
+
+namespace NeoDataInterpolation
+{
+	template <typename T>
+	static void BlendValues(const FProperty* Property, void* Out, const void* From, const void* To, float Alpha)
+	{
+		for (int32 ArrayIndex = 0; ArrayIndex < Property->ArrayDim; ++ArrayIndex)
+		{
+			*Property->ContainerPtrToValuePtr<T>(Out, ArrayIndex) = FMath::Lerp(
+				*Property->ContainerPtrToValuePtr<T>(From, ArrayIndex),
+				*Property->ContainerPtrToValuePtr<T>(To, ArrayIndex),
+				Alpha);
+		}
+	}
+
+	bool IsInterpolatable(const FProperty* Property)
+	{
+		if (Property->IsA<FFloatProperty>() || Property->IsA<FDoubleProperty>())
+		{
+			return true;
+		}
+
+		if (const FStructProperty* StructProperty = CastField<FStructProperty>(Property))
+		{
+			const UScriptStruct* Struct = StructProperty->Struct;
+			return Struct == TBaseStructure<FVector>::Get()
+				|| Struct == TBaseStructure<FVector2D>::Get()
+				|| Struct == TBaseStructure<FRotator>::Get()
+				|| Struct == TBaseStructure<FQuat>::Get()
+				|| Struct == TBaseStructure<FLinearColor>::Get();
+		}
+
+		return false;
+	}
+
+	void Blend(const FProperty* Property, void* Out, const void* From, const void* To, float Alpha)
+	{
+		if (Property->IsA<FFloatProperty>())
+		{
+			BlendValues<float>(Property, Out, From, To, Alpha);
+			return;
+		}
+
+		if (Property->IsA<FDoubleProperty>())
+		{
+			BlendValues<double>(Property, Out, From, To, Alpha);
+			return;
+		}
+
+		const UScriptStruct* Struct = CastFieldChecked<FStructProperty>(Property)->Struct;
+		if (Struct == TBaseStructure<FVector>::Get())
+		{
+			BlendValues<FVector>(Property, Out, From, To, Alpha);
+		}
+		else if (Struct == TBaseStructure<FVector2D>::Get())
+		{
+			BlendValues<FVector2D>(Property, Out, From, To, Alpha);
+		}
+		else if (Struct == TBaseStructure<FRotator>::Get())
+		{
+			// FMath::Lerp on rotators takes the shortest path
+			BlendValues<FRotator>(Property, Out, From, To, Alpha);
+		}
+		else if (Struct == TBaseStructure<FQuat>::Get())
+		{
+			for (int32 ArrayIndex = 0; ArrayIndex < Property->ArrayDim; ++ArrayIndex)
+			{
+				*Property->ContainerPtrToValuePtr<FQuat>(Out, ArrayIndex) = FQuat::Slerp(
+					*Property->ContainerPtrToValuePtr<FQuat>(From, ArrayIndex),
+					*Property->ContainerPtrToValuePtr<FQuat>(To, ArrayIndex),
+					Alpha);
+			}
+		}
+		else if (Struct == TBaseStructure<FLinearColor>::Get())
+		{
+			BlendValues<FLinearColor>(Property, Out, From, To, Alpha);
+		}
+	}
+}
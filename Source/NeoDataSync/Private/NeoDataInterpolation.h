@@ -0,0 +1,14 @@
+// Copyright 2025-2026 NeoNexus Studios. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+namespace NeoDataInterpolation
+{
+	/** True for float, double, FVector, FVector2D, FRotator, FQuat and FLinearColor properties. */
+	bool IsInterpolatable(const FProperty* Property);
+
+	/** Writes the blend of From and To at Alpha into Out. All three point at containers of Property's owner struct. */
+	void Blend(const FProperty* Property, void* Out, const void* From, const void* To, float Alpha);
+}
@@ -0,0 +1,46 @@
+// Copyright 2025-2026 NeoNexus Studios. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Math/VectorRegister.h"
+
+namespace NeoDataKeyScan
+{
+	/**
+	 * Calls Visitor(Index) for each Hashes[Index] == Hash, in order, until it returns true.
+	 * Compares four hashes per instruction through UE's vector layer (SSE on x64, NEON on ARM).
+	 * @return the index the visitor accepted, or INDEX_NONE.
+	 */
+	template <typename VisitorT>
+	FORCEINLINE int32 FindHash(const uint32* Hashes, int32 Num, uint32 Hash, VisitorT&& Visitor)
+	{
+		const VectorRegister4Int Needle = VectorIntSet1(static_cast<int32>(Hash));
+
+		int32 Index = 0;
+		for (; Index + 4 <= Num; Index += 4)
+		{
+			const VectorRegister4Int Block = VectorIntLoad(Hashes + Index);
+			int32 Mask = VectorMaskBits(VectorCastIntToFloat(VectorIntCompareEQ(Block, Needle)));
+			while (Mask)
+			{
+				const int32 Lane = FMath::CountTrailingZeros(static_cast<uint32>(Mask));
+				if (Visitor(Index + Lane))
+				{
+					return Index + Lane;
+				}
+				Mask &= Mask - 1;
+			}
+		}
+
+		for (; Index < Num; ++Index)
+		{
+			if (Hashes[Index] == Hash && Visitor(Index))
+			{
+				return Index;
+			}
+		}
+
+		return INDEX_NONE;
+	}
+}
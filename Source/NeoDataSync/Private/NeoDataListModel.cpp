@@ -0,0 +1,463 @@
+// Copyright 2025-2026 NeoNexus Studios. All Rights Reserved.
+
+#include "NeoDataListModel.h"
+#include "Algo/StableSort.h"
+#include "Components/ListView.h"
+#include "Engine/World.h"
+#include "TimerManager.h"
+#include "UObject/UnrealType.h"
+
+namespace NeoDataListModel
+{
+	template <typename T>
+	static int32 CompareOrdered(const T& A, const T& B)
+	{
+		return A < B ? -1 : (B < A ? 1 : 0);
+	}
+
+	/** Three-way comparison of one property's value in two containers; 0 for unsupported types. */
+	static int32 CompareProperty(const FProperty* Property, const void* A, const void* B)
+	{
+		const void* ValueA = Property->ContainerPtrToValuePtr<void>(A);
+		const void* ValueB = Property->ContainerPtrToValuePtr<void>(B);
+
+		if (const FNumericProperty* Numeric = CastField<FNumericProperty>(Property))
+		{
+			if (Numeric->IsFloatingPoint())
+			{
+				return CompareOrdered(Numeric->GetFloatingPointPropertyValue(ValueA), Numeric->GetFloatingPointPropertyValue(ValueB));
+			}
+			return CompareOrdered(Numeric->GetSignedIntPropertyValue(ValueA), Numeric->GetSignedIntPropertyValue(ValueB));
+		}
+		if (const FEnumProperty* Enum = CastField<FEnumProperty>(Property))
+		{
+			const FNumericProperty* Underlying = Enum->GetUnderlyingProperty();
+			return CompareOrdered(Underlying->GetSignedIntPropertyValue(ValueA), Underlying->GetSignedIntPropertyValue(ValueB));
+		}
+		if (const FBoolProperty* Bool = CastField<FBoolProperty>(Property))
+		{
+			return CompareOrdered(Bool->GetPropertyValue(ValueA), Bool->GetPropertyValue(ValueB));
+		}
+		if (const FStrProperty* Str = CastField<FStrProperty>(Property))
+		{
+			return Str->GetPropertyValue(ValueA).Compare(Str->GetPropertyValue(ValueB), ESearchCase::IgnoreCase);
+		}
+		if (const FNameProperty* Name = CastField<FNameProperty>(Property))
+		{
+			return Name->GetPropertyValue(ValueA).Compare(Name->GetPropertyValue(ValueB));
+		}
+		if (const FTextProperty* Text = CastField<FTextProperty>(Property))
+		{
+			return Text->GetPropertyValue(ValueA).CompareTo(Text->GetPropertyValue(ValueB));
+		}
+		return 0;
+	}
+
+	static bool IsSortable(const FProperty* Property)
+	{
+		return Property->IsA<FNumericProperty>() || Property->IsA<FEnumProperty>() || Property->IsA<FBoolProperty>()
+			|| Property->IsA<FStrProperty>() || Property->IsA<FNameProperty>() || Property->IsA<FTextProperty>();
+	}
+}
+
+UNeoDataListModel* UNeoDataListModel::CreateListModel(UNeoReplicatedDataComponent* Component, UScriptStruct* ValueType,
+	FName SortProperty, bool bSortDescending)
+{
+	if (!Component)
+	{
+		return nullptr;
+	}
+
+	UNeoDataListModel* Model = NewObject<UNeoDataListModel>(Component);
+	Model->Initialize(Component, ValueType, SortProperty, bSortDescending);
+	return Model;
+}
+
+void UNeoDataListModel::Initialize(UNeoReplicatedDataComponent* InComponent, const UScriptStruct* InValueType, FName InSortProperty, bool bInSortDescending)
+{
+	UnbindComponent();
+
+	Component = InComponent;
+	ValueType = InValueType;
+	bSortDescending = bInSortDescending;
+
+	if (!InSortProperty.IsNone())
+	{
+		const FProperty* Property = ValueType ? FindFProperty<FProperty>(ValueType, InSortProperty) : nullptr;
+		if (Property && NeoDataListModel::IsSortable(Property))
+		{
+			SortProperty = Property;
+		}
+		else
+		{
+			UE_LOG(LogTemp, Warning, TEXT("[NeoDataSync] List model: '%s' is not a sortable property of '%s'; using insertion order"),
+				*InSortProperty.ToString(), ValueType ? *ValueType->GetName() : TEXT("None"));
+		}
+	}
+
+	InComponent->OnKeyAdded.AddDynamic(this, &UNeoDataListModel::HandleKeyAdded);
+	InComponent->OnKeyUpdated.AddDynamic(this, &UNeoDataListModel::HandleKeyUpdated);
+	InComponent->OnKeyRemoved.AddDynamic(this, &UNeoDataListModel::HandleKeyRemoved);
+	InComponent->OnDataReset.AddDynamic(this, &UNeoDataListModel::HandleDataReset);
+
+	Rebuild();
+}
+
+void UNeoDataListModel::UnbindComponent()
+{
+	if (UNeoReplicatedDataComponent* Owner = Component.Get())
+	{
+		Owner->OnKeyAdded.RemoveDynamic(this, &UNeoDataListModel::HandleKeyAdded);
+		Owner->OnKeyUpdated.RemoveDynamic(this, &UNeoDataListModel::HandleKeyUpdated);
+		Owner->OnKeyRemoved.RemoveDynamic(this, &UNeoDataListModel::HandleKeyRemoved);
+		Owner->OnDataReset.RemoveDynamic(this, &UNeoDataListModel::HandleDataReset);
+	}
+	Component.Reset();
+}
+
+void UNeoDataListModel::BeginDestroy()
+{
+	UnbindComponent();
+	Super::BeginDestroy();
+}
+
+void UNeoDataListModel::Rebuild()
+{
+	// Keep the item objects of keys that are still listed so views keep their entry widgets
+	TMap<FRecordKey, UNeoDataListItem*> PreviousItems = MoveTemp(ItemsByKey);
+	ItemsByKey.Reset();
+	Rows.Reset();
+
+	if (const UNeoReplicatedDataComponent* Owner = Component.Get())
+	{
+		// What readers see: a transaction still being received is listed once it is applied
+		TArray<FRecordKey> Keys;
+		Owner->DataMap.GetKeys(Keys);
+		for (const FRecordKey& Key : Keys)
+		{
+			const FRecordDefinition* Value = Owner->DataMap.Find(Key);
+			if (!Value || !PassesFilter(*Value))
+			{
+				continue;
+			}
+
+			UNeoDataListItem* Item = nullptr;
+			if (UNeoDataListItem** Previous = PreviousItems.Find(Key))
+			{
+				Item = *Previous;
+			}
+			else
+			{
+				Item = NewObject<UNeoDataListItem>(this);
+				Item->Key = Key;
+				Item->Sequence = NextSequence++;
+			}
+			Item->Value = *Value;
+
+			Rows.Add(Item);
+			ItemsByKey.Add(Key, Item);
+		}
+	}
+
+	Algo::StableSort(Rows, [this](const TObjectPtr<UNeoDataListItem>& A, const TObjectPtr<UNeoDataListItem>& B)
+	{
+		return CompareRows(*A, *B) < 0;
+	});
+	ReindexRows(0, Rows.Num() - 1);
+	FirstStaleRow = INDEX_NONE;
+}
+
+TArray<UObject*> UNeoDataListModel::GetItems() const
+{
+	return TArray<UObject*>(Rows);
+}
+
+int32 UNeoDataListModel::IndexOfKey(const FRecordKey& InKey) const
+{
+	FRecordKey NormalizedKey;
+	UNeoDataListItem* const* Item = ItemsByKey.Find(InKey.Normalize(NormalizedKey));
+	if (!Item)
+	{
+		return INDEX_NONE;
+	}
+
+	ReindexStaleRows();
+	return (*Item)->Row;
+}
+
+bool UNeoDataListModel::PassesFilter(const FRecordDefinition& Value) const
+{
+	return !ValueType || Value.Payload.GetScriptStruct() == ValueType;
+}
+
+int32 UNeoDataListModel::CompareRows(const UNeoDataListItem& A, const UNeoDataListItem& B) const
+{
+	if (SortProperty)
+	{
+		const uint8* MemoryA = A.Value.Payload.GetMemory();
+		const uint8* MemoryB = B.Value.Payload.GetMemory();
+		if (MemoryA && MemoryB)
+		{
+			const int32 Result = NeoDataListModel::CompareProperty(SortProperty, MemoryA, MemoryB);
+			if (Result != 0)
+			{
+				return bSortDescending ? -Result : Result;
+			}
+		}
+	}
+
+	return NeoDataListModel::CompareOrdered(A.Sequence, B.Sequence);
+}
+
+int32 UNeoDataListModel::FindInsertIndex(const UNeoDataListItem& Item) const
+{
+	if (!SortProperty)
+	{
+		return Rows.Num();
+	}
+
+	// Sequence breaks ties, so no two rows compare equal and this is the unique slot
+	int32 Low = 0;
+	int32 High = Rows.Num();
+	while (Low < High)
+	{
+		const int32 Mid = Low + (High - Low) / 2;
+		if (CompareRows(*Rows[Mid], Item) < 0)
+		{
+			Low = Mid + 1;
+		}
+		else
+		{
+			High = Mid;
+		}
+	}
+	return Low;
+}
+
+void UNeoDataListModel::InsertRow(UNeoDataListItem* Item, int32 Index)
+{
+	Rows.Insert(Item, Index);
+	ItemsByKey.Add(Item->Key, Item);
+	Item->Row = Index;
+
+	// Rows after Index shifted down; a burst of inserts renumbers them once, on the next read
+	if (Index + 1 < Rows.Num())
+	{
+		FirstStaleRow = FirstStaleRow == INDEX_NONE ? Index + 1 : FMath::Min(FirstStaleRow, Index + 1);
+	}
+}
+
+void UNeoDataListModel::RemoveRow(int32 Index)
+{
+	ItemsByKey.Remove(Rows[Index]->Key);
+	Rows[Index]->Row = INDEX_NONE;
+	Rows.RemoveAt(Index, 1, false);
+
+	if (Index < Rows.Num())
+	{
+		FirstStaleRow = FirstStaleRow == INDEX_NONE ? Index : FMath::Min(FirstStaleRow, Index);
+	}
+}
+
+void UNeoDataListModel::ReindexRows(int32 First, int32 Last) const
+{
+	for (int32 Index = First; Index <= Last; ++Index)
+	{
+		Rows[Index]->Row = Index;
+	}
+}
+
+void UNeoDataListModel::ReindexStaleRows() const
+{
+	if (FirstStaleRow != INDEX_NONE)
+	{
+		ReindexRows(FirstStaleRow, Rows.Num() - 1);
+		FirstStaleRow = INDEX_NONE;
+	}
+}
+
+void UNeoDataListModel::HandleKeyAdded(const FRecordKey& Key, const FRecordDefinition& Value)
+{
+	if (ItemsByKey.Contains(Key))
+	{
+		HandleKeyUpdated(Key, Value);
+		return;
+	}
+
+	if (!PassesFilter(Value))
+	{
+		return;
+	}
+
+	UNeoDataListItem* Item = NewObject<UNeoDataListItem>(this);
+	Item->Key = Key;
+	Item->Value = Value;
+	Item->Sequence = NextSequence++;
+
+	const int32 Index = FindInsertIndex(*Item);
+	InsertRow(Item, Index);
+	SyncListView(ENeoDataListOpType::Insert, Index, Item);
+
+	FNeoDataListOp Op;
+	Op.Type = ENeoDataListOpType::Insert;
+	Op.Index = Index;
+	Op.Key = Key;
+	OnListChanged.Broadcast({ Op });
+}
+
+void UNeoDataListModel::HandleKeyUpdated(const FRecordKey& Key, const FRecordDefinition& Value)
+{
+	UNeoDataListItem** Found = ItemsByKey.Find(Key);
+	if (!Found)
+	{
+		// The value may have changed into the filtered type
+		if (PassesFilter(Value))
+		{
+			HandleKeyAdded(Key, Value);
+		}
+		return;
+	}
+
+	if (!PassesFilter(Value))
+	{
+		HandleKeyRemoved(Key);
+		return;
+	}
+
+	UNeoDataListItem* Item = *Found;
+	Item->Value = Value;
+	ReindexStaleRows();
+
+	TArray<FNeoDataListOp, TInlineAllocator<2>> Ops;
+
+	// Only a changed sort key can move the row; checking the neighbours is enough to know
+	const int32 FromIndex = Item->Row;
+	const bool bOutOfOrder = SortProperty
+		&& ((FromIndex > 0 && CompareRows(*Rows[FromIndex - 1], *Item) > 0)
+			|| (FromIndex + 1 < Rows.Num() && CompareRows(*Item, *Rows[FromIndex + 1]) > 0));
+	if (bOutOfOrder)
+	{
+		Rows.RemoveAt(FromIndex, 1, false);
+		const int32 ToIndex = FindInsertIndex(*Item);
+		Rows.Insert(Item, ToIndex);
+		ReindexRows(FMath::Min(FromIndex, ToIndex), FMath::Max(FromIndex, ToIndex));
+		SyncListView(ENeoDataListOpType::Move, ToIndex, Item);
+
+		FNeoDataListOp& Move = Ops.AddDefaulted_GetRef();
+		Move.Type = ENeoDataListOpType::Move;
+		Move.Index = ToIndex;
+		Move.FromIndex = FromIndex;
+		Move.Key = Key;
+	}
+
+	FNeoDataListOp& Update = Ops.AddDefaulted_GetRef();
+	Update.Type = ENeoDataListOpType::Update;
+	Update.Index = Item->Row;
+	Update.Key = Key;
+
+	Item->OnValueChanged.Broadcast(Item);
+	OnListChanged.Broadcast(TArray<FNeoDataListOp>(Ops));
+}
+
+void UNeoDataListModel::HandleKeyRemoved(const FRecordKey& Key)
+{
+	UNeoDataListItem** Found = ItemsByKey.Find(Key);
+	if (!Found)
+	{
+		return;
+	}
+
+	UNeoDataListItem* Item = *Found;
+	ReindexStaleRows();
+	const int32 Index = Item->Row;
+	RemoveRow(Index);
+	SyncListView(ENeoDataListOpType::Remove, Index, Item);
+
+	FNeoDataListOp Op;
+	Op.Type = ENeoDataListOpType::Remove;
+	Op.Index = Index;
+	Op.Key = Key;
+	OnListChanged.Broadcast({ Op });
+}
+
+void UNeoDataListModel::HandleDataReset()
+{
+	Rebuild();
+	SyncListView(ENeoDataListOpType::Reset, INDEX_NONE, nullptr);
+
+	FNeoDataListOp Op;
+	Op.Type = ENeoDataListOpType::Reset;
+	OnListChanged.Broadcast({ Op });
+}
+
+void UNeoDataListModel::BindListView(UListView* ListView)
+{
+	BoundListView = ListView;
+	bListViewDirty = false;
+	if (ListView)
+	{
+		ListView->SetListItems(GetItems());
+	}
+}
+
+void UNeoDataListModel::SyncListView(ENeoDataListOpType Type, int32 Index, UNeoDataListItem* Item)
+{
+	UListView* ListView = BoundListView.Get();
+	if (!ListView)
+	{
+		return;
+	}
+
+	switch (Type)
+	{
+	case ENeoDataListOpType::Insert:
+		if (Index == Rows.Num() - 1)
+		{
+			ListView->AddItem(Item);
+			return;
+		}
+		break;
+
+	case ENeoDataListOpType::Remove:
+		ListView->RemoveItem(Item);
+		return;
+
+	case ENeoDataListOpType::Update:
+		// Entry widgets refresh themselves through UNeoDataListItem::OnValueChanged
+		return;
+
+	default:
+		break;
+	}
+
+	// Mid-list inserts, moves and resets: re-set the list once for everything that changes this frame.
+	// The view reuses the entry widgets of items it already shows.
+	if (bListViewDirty)
+	{
+		return;
+	}
+
+	UWorld* World = ListView->GetWorld();
+	if (!World)
+	{
+		ListView->SetListItems(GetItems());
+		return;
+	}
+
+	bListViewDirty = true;
+	World->GetTimerManager().SetTimerForNextTick(FTimerDelegate::CreateUObject(this, &UNeoDataListModel::FlushListView));
+}
+
+void UNeoDataListModel::FlushListView()
+{
+	if (!bListViewDirty)
+	{
+		return;
+	}
+
+	bListViewDirty = false;
+	if (UListView* ListView = BoundListView.Get())
+	{
+		ListView->SetListItems(GetItems());
+	}
+}
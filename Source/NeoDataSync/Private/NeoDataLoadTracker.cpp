@@ -0,0 +1,74 @@
+// Copyright 2025-2026 NeoNexus Studios. All Rights Reserved.
+
+#include "NeoDataLoadTracker.h"
+#include "HAL/IConsoleManager.h"
+
+FNeoDataLoadTracker& FNeoDataLoadTracker::Get()
+{
+	static FNeoDataLoadTracker Tracker;
+	return Tracker;
+}
+
+void FNeoDataLoadTracker::Record(ENeoDataLoadPhase Phase, double Seconds, int64 Bytes)
+{
+	FPhaseStats& Stats = Phases[static_cast<int32>(Phase)];
+	++Stats.Count;
+	Stats.TotalBytes += Bytes;
+	Stats.TotalSeconds += Seconds;
+	Stats.MaxSeconds = FMath::Max(Stats.MaxSeconds, Seconds);
+}
+
+void FNeoDataLoadTracker::Report(FOutputDevice& Ar) const
+{
+	static const TCHAR* PhaseNames[] =
+	{
+		TEXT("Register"),
+		TEXT("TimeToBeginPlay"),
+		TEXT("Populate"),
+		TEXT("FirstSend"),
+		TEXT("TimeToFirstSend"),
+		TEXT("FirstReceive"),
+		TEXT("TimeToFirstReceive"),
+	};
+	static_assert(UE_ARRAY_COUNT(PhaseNames) == static_cast<int32>(ENeoDataLoadPhase::Num), "PhaseNames out of date");
+
+	Ar.Logf(TEXT("[NeoDataSync] Load report"));
+	Ar.Logf(TEXT("  %-20s %8s %12s %10s %10s %10s"), TEXT("Phase"), TEXT("Count"), TEXT("Total ms"), TEXT("Avg ms"), TEXT("Max ms"), TEXT("Total KB"));
+	for (int32 Index = 0; Index < static_cast<int32>(ENeoDataLoadPhase::Num); ++Index)
+	{
+		const FPhaseStats& Stats = Phases[Index];
+		Ar.Logf(TEXT("  %-20s %8d %12.3f %10.3f %10.3f %10.1f"),
+			PhaseNames[Index],
+			Stats.Count,
+			Stats.TotalSeconds * 1000.0,
+			Stats.Count > 0 ? Stats.TotalSeconds * 1000.0 / Stats.Count : 0.0,
+			Stats.MaxSeconds * 1000.0,
+			Stats.TotalBytes / 1024.0);
+	}
+}
+
+void FNeoDataLoadTracker::Reset()
+{
+	for (FPhaseStats& Stats : Phases)
+	{
+		Stats = FPhaseStats();
+	}
+}
+
+#if !UE_BUILD_SHIPPING
+
+static FAutoConsoleCommand CmdNeoDataLoadReport(
+	TEXT("NeoData.LoadReport"),
+	TEXT("Prints NeoData component startup timings and first send/receive sizes (registration, time to BeginPlay, population, first send, first client apply). Usage: NeoData.LoadReport [reset]"),
+	FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+	{
+		if (Args.Num() > 0 && Args[0] == TEXT("reset"))
+		{
+			FNeoDataLoadTracker::Get().Reset();
+			UE_LOG(LogTemp, Display, TEXT("[NeoDataSync] Load report reset"));
+			return;
+		}
+		FNeoDataLoadTracker::Get().Report(*GLog);
+	}));
+
+#endif // !UE_BUILD_SHIPPING
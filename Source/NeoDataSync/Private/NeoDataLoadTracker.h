@@ -0,0 +1,72 @@
+// Copyright 2025-2026 NeoNexus Studios. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/** Startup phases timed for every UNeoReplicatedDataComponent. */
+enum class ENeoDataLoadPhase : uint8
+{
+	/** OnRegister. */
+	Register,
+	/** Register to BeginPlay: actor initialization and whatever else the level load or spawn does in between. */
+	TimeToBeginPlay,
+	/** Server writes (SetData, BulkLoad, ...) before the first send. */
+	Populate,
+	/** First server NetDeltaSerialize (initial full send to the first connection), with its size. */
+	FirstSend,
+	/** Register to first send. */
+	TimeToFirstSend,
+	/** First client NetDeltaSerialize, including item callbacks and notifications, with its size. */
+	FirstReceive,
+	/** Register to first receive. */
+	TimeToFirstReceive,
+
+	Num
+};
+
+/**
+ * Process-wide aggregate of component load timings, printed by NeoData.LoadReport. Game thread only.
+ */
+class FNeoDataLoadTracker
+{
+public:
+	static FNeoDataLoadTracker& Get();
+
+	void Record(ENeoDataLoadPhase Phase, double Seconds, int64 Bytes = 0);
+	void Report(FOutputDevice& Ar) const;
+	void Reset();
+
+private:
+	struct FPhaseStats
+	{
+		int32 Count = 0;
+		double TotalSeconds = 0.0;
+		double MaxSeconds = 0.0;
+		int64 TotalBytes = 0;
+	};
+
+	FPhaseStats Phases[static_cast<int32>(ENeoDataLoadPhase::Num)];
+};
+
+/** Adds the scope's duration to Seconds when bEnabled. */
+struct FNeoDataLoadScope
+{
+	FNeoDataLoadScope(double& InSeconds, bool bEnabled)
+		: Seconds(bEnabled ? &InSeconds : nullptr)
+		, StartTime(bEnabled ? FPlatformTime::Seconds() : 0.0)
+	{
+	}
+
+	~FNeoDataLoadScope()
+	{
+		if (Seconds)
+		{
+			*Seconds += FPlatformTime::Seconds() - StartTime;
+		}
+	}
+
+private:
+	double* Seconds;
+	double StartTime;
+};
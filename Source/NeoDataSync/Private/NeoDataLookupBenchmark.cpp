@@ -0,0 +1,90 @@
+// Copyright 2025-2026 NeoNexus Studios. All Rights Reserved.
+
+#include "NeoReplicatedData.h"
+#include "HAL/IConsoleManager.h"
+
+#if !UE_BUILD_SHIPPING
+
+/**
+ * Times the key lookup strategies of FNeoDataMap against each other on the same data.
+ * Usage: NeoData.BenchLookup [NumEntries=64] [NumLookups=100000]
+ */
+struct FNeoDataLookupBenchmark
+{
+	static void Run(int32 NumEntries, int32 NumLookups)
+	{
+		FNeoDataMap Map;
+		TArray<FRecordKey> Keys;
+		Keys.Reserve(NumEntries);
+
+		for (int32 Index = 0; Index < NumEntries; ++Index)
+		{
+			FNeoDataDefinition_SI KeyStruct;
+			KeyStruct.StringValue = FString::Printf(TEXT("Key_%d"), Index);
+			KeyStruct.IntValue = Index;
+
+			FRecordKey& Key = Keys.Add_GetRef(FRecordKey(FInstancedStruct::Make(KeyStruct)));
+			Map.AddOrUpdate(Key, FRecordDefinition(FInstancedStruct::Make(KeyStruct)));
+		}
+
+		Map.RefreshKeyHashes();
+		Map.RefreshKeyIndex();
+
+		// Sum of found indexes keeps the optimizer from discarding the loops
+		auto Measure = [&Keys, NumLookups](const TCHAR* Label, TFunctionRef<int32(const FRecordKey&)> Lookup)
+		{
+			int64 Checksum = 0;
+			const double StartTime = FPlatformTime::Seconds();
+			for (int32 LookupIndex = 0; LookupIndex < NumLookups; ++LookupIndex)
+			{
+				Checksum += Lookup(Keys[LookupIndex % Keys.Num()]);
+			}
+			const double Elapsed = FPlatformTime::Seconds() - StartTime;
+
+			UE_LOG(LogTemp, Display, TEXT("[NeoDataSync]   %-24s %8.1f ns/lookup (checksum %lld)"),
+				Label, Elapsed * 1.0e9 / NumLookups, Checksum);
+		};
+
+		UE_LOG(LogTemp, Display, TEXT("[NeoDataSync] Lookup benchmark: %d entries, %d lookups"), NumEntries, NumLookups);
+
+		Measure(TEXT("Full compare scan"), [&Map](const FRecordKey& Key)
+		{
+			return Map.Items.IndexOfByPredicate([&Key](const FNeoDataEntry& Entry) { return Entry.Key == Key; });
+		});
+
+		Measure(TEXT("Scalar hash scan"), [&Map](const FRecordKey& Key)
+		{
+			const uint32 KeyHash = GetTypeHash(Key);
+			for (int32 Index = 0; Index < Map.KeyHashes.Num(); ++Index)
+			{
+				if (Map.KeyHashes[Index] == KeyHash && Map.Items[Index].Key == Key)
+				{
+					return Index;
+				}
+			}
+			return int32(INDEX_NONE);
+		});
+
+		Measure(TEXT("Vector hash scan"), [&Map](const FRecordKey& Key)
+		{
+			return Map.IndexOfKeyScan(Key, GetTypeHash(Key));
+		});
+
+		Measure(TEXT("Hash index"), [&Map](const FRecordKey& Key)
+		{
+			return Map.IndexOfKeyIndexed(Key, GetTypeHash(Key));
+		});
+	}
+};
+
+static FAutoConsoleCommand CmdNeoDataBenchLookup(
+	TEXT("NeoData.BenchLookup"),
+	TEXT("Times FNeoDataMap key lookup strategies. Usage: NeoData.BenchLookup [NumEntries=64] [NumLookups=100000]"),
+	FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+	{
+		const int32 NumEntries = Args.Num() > 0 ? FMath::Max(1, FCString::Atoi(*Args[0])) : 64;
+		const int32 NumLookups = Args.Num() > 1 ? FMath::Max(1, FCString::Atoi(*Args[1])) : 100000;
+		FNeoDataLookupBenchmark::Run(NumEntries, NumLookups);
+	}));
+
+#endif // !UE_BUILD_SHIPPING
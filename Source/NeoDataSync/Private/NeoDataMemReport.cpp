@@ -0,0 +1,92 @@
+// Copyright 2025-2026 NeoNexus Studios. All Rights Reserved.
+
+#include "NeoReplicatedData.h"
+#include "HAL/IConsoleManager.h"
+#include "UObject/UObjectIterator.h"
+#include "GameFramework/Actor.h"
+
+#if !UE_BUILD_SHIPPING
+
+/**
+ * Memory of every live NeoData component and the per-type totals across them.
+ * Listed under [MemReportCommands] in the plugin's engine config, so memreport includes it.
+ * Usage: NeoData.MemReport
+ */
+static void NeoDataMemReport(FOutputDevice& Ar)
+{
+	TMap<const UScriptStruct*, FNeoDataTypeMemory> TypeTotals;
+	FNeoDataMemoryUsage Totals;
+	int32 NumComponents = 0;
+
+	Ar.Logf(TEXT("[NeoDataSync] Component memory (KB)"));
+	Ar.Logf(TEXT("  %-48s %8s %10s %10s %10s %10s %10s"), TEXT("Component"), TEXT("Entries"), TEXT("Items"), TEXT("Payloads"), TEXT("Index"), TEXT("Caches"), TEXT("Total"));
+
+	for (TObjectIterator<UNeoReplicatedDataComponent> It(RF_ClassDefaultObject | RF_ArchetypeObject, true, EInternalObjectFlags::Garbage); It; ++It)
+	{
+		const UNeoReplicatedDataComponent* Component = *It;
+		const FNeoDataMemoryUsage Usage = Component->GetMemoryUsage();
+
+		const AActor* OwnerActor = Component->GetOwner();
+		Ar.Logf(TEXT("  %-48s %8d %10.1f %10.1f %10.1f %10.1f %10.1f"),
+			*FString::Printf(TEXT("%s.%s"), OwnerActor ? *OwnerActor->GetName() : TEXT("None"), *Component->GetName()),
+			Component->DataMap.Items.Num(),
+			Usage.ItemsBytes / 1024.0,
+			Usage.PayloadBytes / 1024.0,
+			Usage.IndexBytes / 1024.0,
+			Usage.CacheBytes / 1024.0,
+			Usage.GetTotalBytes() / 1024.0);
+
+		Totals.ItemsBytes += Usage.ItemsBytes;
+		Totals.PayloadBytes += Usage.PayloadBytes;
+		Totals.IndexBytes += Usage.IndexBytes;
+		Totals.CacheBytes += Usage.CacheBytes;
+		++NumComponents;
+
+		for (const FNeoDataTypeMemory& Type : Usage.Types)
+		{
+			FNeoDataTypeMemory& Total = TypeTotals.FindOrAdd(Type.Struct);
+			Total.Struct = Type.Struct;
+			Total.NumKeys += Type.NumKeys;
+			Total.NumValues += Type.NumValues;
+			Total.KeyBytes += Type.KeyBytes;
+			Total.ValueBytes += Type.ValueBytes;
+		}
+	}
+
+	Ar.Logf(TEXT("  %d components: items %.1f, payloads %.1f, index %.1f, caches %.1f, total %.1f KB"),
+		NumComponents,
+		Totals.ItemsBytes / 1024.0,
+		Totals.PayloadBytes / 1024.0,
+		Totals.IndexBytes / 1024.0,
+		Totals.CacheBytes / 1024.0,
+		Totals.GetTotalBytes() / 1024.0);
+
+	TypeTotals.ValueSort([](const FNeoDataTypeMemory& A, const FNeoDataTypeMemory& B)
+	{
+		return A.KeyBytes + A.ValueBytes > B.KeyBytes + B.ValueBytes;
+	});
+
+	Ar.Logf(TEXT("[NeoDataSync] Payload memory by type (KB)"));
+	Ar.Logf(TEXT("  %-48s %8s %10s %8s %10s %10s"), TEXT("Struct"), TEXT("Keys"), TEXT("Key KB"), TEXT("Values"), TEXT("Value KB"), TEXT("Total"));
+	for (const TPair<const UScriptStruct*, FNeoDataTypeMemory>& Pair : TypeTotals)
+	{
+		const FNeoDataTypeMemory& Type = Pair.Value;
+		Ar.Logf(TEXT("  %-48s %8d %10.1f %8d %10.1f %10.1f"),
+			*GetNameSafe(Type.Struct),
+			Type.NumKeys,
+			Type.KeyBytes / 1024.0,
+			Type.NumValues,
+			Type.ValueBytes / 1024.0,
+			(Type.KeyBytes + Type.ValueBytes) / 1024.0);
+	}
+}
+
+static FAutoConsoleCommand CmdNeoDataMemReport(
+	TEXT("NeoData.MemReport"),
+	TEXT("Prints the heap memory of every NeoData component (items, payloads, key index, caches) and payload memory per struct type."),
+	FConsoleCommandWithArgsAndOutputDeviceDelegate::CreateLambda([](const TArray<FString>& Args, FOutputDevice& Ar)
+	{
+		NeoDataMemReport(Ar);
+	}));
+
+#endif // !UE_BUILD_SHIPPING
@@ -0,0 +1,65 @@
+// Copyright 2025-2026 NeoNexus Studios. All Rights Reserved.
+
+#include "NeoDataPayloadSerialization.h"
+#include "Misc/ScopeRWLock.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+#include "Serialization/ObjectAndNameAsStringProxyArchive.h"
+#include "UObject/ObjectKey.h"
+
+namespace NeoDataPayloadSerialization
+{
+	/** Default instance per struct, the baseline for the delta. Heap allocated so pointers survive map growth. */
+	static TMap<TObjectKey<UScriptStruct>, TUniquePtr<FInstancedStruct>> DefaultsRegistry;
+	static FRWLock DefaultsLock;
+
+	static const uint8* GetDefaults(const UScriptStruct* Struct)
+	{
+		{
+			FReadScopeLock ReadLock(DefaultsLock);
+			if (const TUniquePtr<FInstancedStruct>* Found = DefaultsRegistry.Find(Struct))
+			{
+				return (*Found)->GetMemory();
+			}
+		}
+
+		FWriteScopeLock WriteLock(DefaultsLock);
+		TUniquePtr<FInstancedStruct>& Defaults = DefaultsRegistry.FindOrAdd(Struct);
+		if (!Defaults)
+		{
+			Defaults = MakeUnique<FInstancedStruct>(Struct);
+		}
+		return Defaults->GetMemory();
+	}
+
+	void Save(const FInstancedStruct& Value, TArray<uint8>& OutBytes)
+	{
+		const UScriptStruct* Struct = Value.GetScriptStruct();
+		if (!Struct)
+		{
+			return;
+		}
+
+		FMemoryWriter Writer(OutBytes);
+		FObjectAndNameAsStringProxyArchive Ar(Writer, /*bInLoadIfFindFails*/ false);
+		const_cast<UScriptStruct*>(Struct)->SerializeItem(Ar, const_cast<uint8*>(Value.GetMemory()), GetDefaults(Struct));
+	}
+
+	void Load(const UScriptStruct* Struct, TConstArrayView<uint8> Bytes, FInstancedStruct& OutValue, bool bLoadObjects)
+	{
+		check(!bLoadObjects || IsInGameThread());
+
+		if (!Struct)
+		{
+			OutValue.Reset();
+			return;
+		}
+
+		// Properties missing from Bytes were at their defaults, which InitializeAs already set
+		OutValue.InitializeAs(Struct);
+
+		FMemoryReaderView Reader(Bytes);
+		FObjectAndNameAsStringProxyArchive Ar(Reader, bLoadObjects);
+		const_cast<UScriptStruct*>(Struct)->SerializeItem(Ar, OutValue.GetMutableMemory(), GetDefaults(Struct));
+	}
+}
@@ -0,0 +1,23 @@
+// Copyright 2025-2026 NeoNexus Studios. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "StructUtils/InstancedStruct.h"
+
+/**
+ * Self-describing payload bytes for storage outside the map (history, change stream).
+ * Tagged property serialization against the struct's defaults: only non-default properties are written,
+ * and objects and names are stored as strings so the bytes stay valid across sessions.
+ */
+namespace NeoDataPayloadSerialization
+{
+	/** Appends Value's non-default properties to OutBytes. Writes nothing for an empty payload. */
+	void Save(const FInstancedStruct& Value, TArray<uint8>& OutBytes);
+
+	/**
+	 * Rebuilds a Struct value from Save's bytes. A null Struct yields an empty payload.
+	 * bLoadObjects loads referenced objects that are not in memory; game thread only. Without it they resolve to null.
+	 */
+	void Load(const UScriptStruct* Struct, TConstArrayView<uint8> Bytes, FInstancedStruct& OutValue, bool bLoadObjects = true);
+}
@@ -0,0 +1,44 @@
+// Copyright 2025-2026 NeoNexus Studios. All Rights Reserved.
+
+#include "NeoDataReconnect.h"
+#include "Algo/BinarySearch.h"
+
+FNeoDataReconnect::FNeoDataReconnect(int32 InTombstoneCapacity)
+	: TombstoneCapacity(FMath::Max(InTombstoneCapacity, 1))
+{
+}
+
+void FNeoDataReconnect::AddTombstone(const FRecordKey& Key, int64 Version)
+{
+	if (Tombstones.Num() >= TombstoneCapacity * 2)
+	{
+		const int32 NumDropped = Tombstones.Num() - TombstoneCapacity;
+		Horizon = Tombstones[NumDropped - 1].Version;
+		Tombstones.RemoveAt(0, NumDropped, false);
+	}
+
+	FTombstone& Tombstone = Tombstones.AddDefaulted_GetRef();
+	Tombstone.Key = Key;
+	Tombstone.Version = Version;
+}
+
+bool FNeoDataReconnect::GetRemovedSince(int64 SinceVersion, TArray<FRecordKey>& OutKeys) const
+{
+	if (SinceVersion < Horizon)
+	{
+		return false;
+	}
+
+	// Versions increase along the log
+	const int32 First = Algo::UpperBoundBy(Tombstones, SinceVersion, &FTombstone::Version);
+	for (int32 Index = First; Index < Tombstones.Num(); ++Index)
+	{
+		OutKeys.Add(Tombstones[Index].Key);
+	}
+	return true;
+}
+
+SIZE_T FNeoDataReconnect::GetAllocatedSize() const
+{
+	return Tombstones.GetAllocatedSize() + Connections.GetAllocatedSize();
+}
@@ -0,0 +1,62 @@
+// Copyright 2025-2026 NeoNexus Studios. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "NeoReplicatedData.h"
+#include "UObject/ObjectKey.h"
+
+class UNetConnection;
+
+/**
+ * Server side of reconnect resync for one map.
+ *
+ * Logs removals so a returning client can learn which of its cached entries are gone. Also tracks the
+ * connections whose first send of the map waits for the client's cache report.
+ */
+class FNeoDataReconnect
+{
+public:
+	explicit FNeoDataReconnect(int32 InTombstoneCapacity);
+
+	/** Records Key's removal at Version. The log keeps at least the TombstoneCapacity most recent removals. */
+	void AddTombstone(const FRecordKey& Key, int64 Version);
+
+	/** Appends the keys removed after SinceVersion. False if the log has dropped removals that recent. */
+	bool GetRemovedSince(int64 SinceVersion, TArray<FRecordKey>& OutKeys) const;
+
+	enum class EPhase : uint8
+	{
+		/** Nothing is sent until the client reports its cache or the report timeout passes. */
+		AwaitingReport,
+
+		/** The next send skips the entries the client's cache already holds. */
+		Accepted,
+	};
+
+	struct FConnection
+	{
+		EPhase Phase = EPhase::AwaitingReport;
+		int64 ClientVersion = 0;
+	};
+
+	/** Connections still in resync. Removed once their first filtered send has gone out. */
+	TMap<TObjectKey<UNetConnection>, FConnection> Connections;
+
+	SIZE_T GetAllocatedSize() const;
+
+private:
+	struct FTombstone
+	{
+		FRecordKey Key;
+		int64 Version = 0;
+	};
+
+	int32 TombstoneCapacity;
+
+	/** Oldest first. Trimmed back to TombstoneCapacity whenever it doubles. */
+	TArray<FTombstone> Tombstones;
+
+	/** Version of the newest removal dropped from the log; clients that have not seen it need a full resync. */
+	int64 Horizon = 0;
+};
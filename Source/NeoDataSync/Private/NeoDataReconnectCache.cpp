@@ -0,0 +1,28 @@
+// Copyright 2025-2026 NeoNexus Studios. All Rights Reserved.
+
+#include "NeoDataReconnectCache.h"
+#include "Engine/GameInstance.h"
+#include "Engine/World.h"
+
+UNeoDataReconnectCache* UNeoDataReconnectCache::Get(const UObject* WorldContextObject)
+{
+	const UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+	const UGameInstance* GameInstance = World ? World->GetGameInstance() : nullptr;
+	return GameInstance ? GameInstance->GetSubsystem<UNeoDataReconnectCache>() : nullptr;
+}
+
+void UNeoDataReconnectCache::Store(const FString& Id, FNeoDataCachedState&& State)
+{
+	States.Add(Id, MoveTemp(State));
+}
+
+bool UNeoDataReconnectCache::Take(const FString& Id, FNeoDataCachedState& OutState)
+{
+	return States.RemoveAndCopyValue(Id, OutState);
+}
+
+void UNeoDataReconnectCache::Deinitialize()
+{
+	States.Empty();
+	Super::Deinitialize();
+}
@@ -0,0 +1,128 @@
+// Copyright 2025-2026 NeoNexus Studios. All Rights Reserved.
+
+#include "NeoDataStaticCache.h"
+#include "HAL/IConsoleManager.h"
+#include "Hash/CityHash.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+
+static int32 GNeoDataStaticCacheMaxEntries = 65536;
+static FAutoConsoleVariableRef CVarNeoDataStaticCacheMaxEntries(
+	TEXT("NeoData.StaticCacheMaxEntries"),
+	GNeoDataStaticCacheMaxEntries,
+	TEXT("Most static entry values the client disk cache holds; values beyond it are fetched from the server every session."));
+
+namespace NeoDataStaticCache
+{
+	static constexpr uint32 FileMagic = 0x4E445343; // NDSC
+	static constexpr int32 FileVersion = 1;
+}
+
+FNeoDataStaticCache& FNeoDataStaticCache::Get()
+{
+	static FNeoDataStaticCache Cache;
+	return Cache;
+}
+
+uint64 FNeoDataStaticCache::HashValue(const FInstancedStruct& Value)
+{
+	FString Text;
+	Value.ExportTextItem(Text, FInstancedStruct(), nullptr, PPF_None, nullptr);
+	return CityHash64(reinterpret_cast<const char*>(*Text), Text.Len() * sizeof(TCHAR));
+}
+
+bool FNeoDataStaticCache::Find(uint64 Hash, FInstancedStruct& OutValue)
+{
+	LoadIfNeeded();
+
+	const FString* Text = Texts.Find(Hash);
+	if (!Text)
+	{
+		return false;
+	}
+
+	const TCHAR* Buffer = **Text;
+	if (!OutValue.ImportTextItem(Buffer, PPF_None, nullptr, GLog))
+	{
+		// The struct is gone or no longer parses; the server will send the value
+		Texts.Remove(Hash);
+		bDirty = true;
+		return false;
+	}
+	return true;
+}
+
+void FNeoDataStaticCache::Add(uint64 Hash, const FInstancedStruct& Value)
+{
+	LoadIfNeeded();
+
+	if (Texts.Num() >= GNeoDataStaticCacheMaxEntries || Texts.Contains(Hash))
+	{
+		return;
+	}
+
+	FString& Text = Texts.Add(Hash);
+	Value.ExportTextItem(Text, FInstancedStruct(), nullptr, PPF_None, nullptr);
+	bDirty = true;
+}
+
+void FNeoDataStaticCache::Save()
+{
+	if (!bDirty)
+	{
+		return;
+	}
+
+	TArray<uint8> Bytes;
+	FMemoryWriter Writer(Bytes);
+
+	uint32 Magic = NeoDataStaticCache::FileMagic;
+	int32 Version = NeoDataStaticCache::FileVersion;
+	Writer << Magic << Version << Texts;
+
+	if (FFileHelper::SaveArrayToFile(Bytes, *GetFilePath()))
+	{
+		bDirty = false;
+	}
+	else
+	{
+		UE_LOG(LogTemp, Warning, TEXT("[NeoDataSync] Failed to write static entry cache '%s'"), *GetFilePath());
+	}
+}
+
+void FNeoDataStaticCache::LoadIfNeeded()
+{
+	if (bLoaded)
+	{
+		return;
+	}
+	bLoaded = true;
+
+	TArray<uint8> Bytes;
+	if (!FFileHelper::LoadFileToArray(Bytes, *GetFilePath(), FILEREAD_Silent))
+	{
+		return;
+	}
+
+	FMemoryReader Reader(Bytes);
+	uint32 Magic = 0;
+	int32 Version = 0;
+	Reader << Magic << Version;
+	if (Magic != NeoDataStaticCache::FileMagic || Version != NeoDataStaticCache::FileVersion)
+	{
+		return;
+	}
+
+	Reader << Texts;
+	if (Reader.IsError())
+	{
+		Texts.Reset();
+	}
+}
+
+FString FNeoDataStaticCache::GetFilePath()
+{
+	return FPaths::ProjectSavedDir() / TEXT("NeoDataSync") / TEXT("StaticCache.bin");
+}
@@ -0,0 +1,38 @@
+// Copyright 2025-2026 NeoNexus Studios. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "StructUtils/InstancedStruct.h"
+
+/**
+ * Client-side disk cache of static entry values by content hash, shared by every component and session.
+ *
+ * Values are stored as exported text, so they load in any build with the same struct layout. A changed layout
+ * changes the text and therefore the hash, so outdated values are never matched.
+ * Loaded from Saved/NeoDataSync/StaticCache.bin on first use, saved by Save. Game thread only.
+ */
+class FNeoDataStaticCache
+{
+public:
+	static FNeoDataStaticCache& Get();
+
+	/** Content hash of Value: its struct path and exported text. Identical in every process. */
+	static uint64 HashValue(const FInstancedStruct& Value);
+
+	/** Fills OutValue with the value cached under Hash. */
+	bool Find(uint64 Hash, FInstancedStruct& OutValue);
+
+	void Add(uint64 Hash, const FInstancedStruct& Value);
+
+	/** Writes the cache to disk if it changed since it was loaded or last saved. */
+	void Save();
+
+private:
+	void LoadIfNeeded();
+	static FString GetFilePath();
+
+	TMap<uint64, FString> Texts;
+	bool bLoaded = false;
+	bool bDirty = false;
+};
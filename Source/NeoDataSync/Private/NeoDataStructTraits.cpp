@@ -0,0 +1,370 @@
+// Copyright 2025-2026 NeoNexus Studios. All Rights Reserved.
+
+#include "NeoDataStructTraits.h"
+#include "Misc/ScopeRWLock.h"
+#include "UObject/ObjectKey.h"
+#include "UObject/UnrealType.h"
+#include "StructUtils/InstancedStruct.h"
+
+namespace NeoDataStructTraits
+{
+	/** Resolved traits per struct. Values are heap allocated so references stay valid while the map grows. */
+	static TMap<TObjectKey<UScriptStruct>, TUniquePtr<FNeoStructTraits>> Registry;
+	static FRWLock RegistryLock;
+
+	/** True if every byte of the struct is integral property data, so memcmp matches per-property equality. */
+	static bool IsMemcmpSafe(const UStruct* Struct)
+	{
+		int32 PropertyBytes = 0;
+		for (TFieldIterator<FProperty> It(Struct); It; ++It)
+		{
+			const FProperty* Property = *It;
+
+			if (const FStructProperty* StructProperty = CastField<FStructProperty>(Property))
+			{
+				if (!IsMemcmpSafe(StructProperty->Struct))
+				{
+					return false;
+				}
+			}
+			else if (const FBoolProperty* BoolProperty = CastField<FBoolProperty>(Property))
+			{
+				// Bitfield bools share a byte with unrelated bits
+				if (!BoolProperty->IsNativeBool())
+				{
+					return false;
+				}
+			}
+			else if (const FNumericProperty* NumericProperty = CastField<FNumericProperty>(Property))
+			{
+				// Floats: -0 == +0 and NaN != NaN, so bytes are not equality
+				if (!NumericProperty->IsInteger())
+				{
+					return false;
+				}
+			}
+			else if (!Property->IsA<FEnumProperty>())
+			{
+				return false;
+			}
+
+			PropertyBytes += Property->GetSize();
+		}
+
+		// Any difference is padding, which is not guaranteed to be zeroed
+		return PropertyBytes == Struct->GetStructureSize();
+	}
+
+	/** True if no property below Property serializes through per-connection package map state (NetGUIDs). */
+	static bool IsNetConnectionIndependent(const FProperty* Property)
+	{
+		if (Property->IsA<FObjectPropertyBase>() || Property->IsA<FInterfaceProperty>()
+			|| Property->IsA<FDelegateProperty>() || Property->IsA<FMulticastDelegateProperty>())
+		{
+			return false;
+		}
+
+		if (const FStructProperty* StructProperty = CastField<FStructProperty>(Property))
+		{
+			// Instanced structs write their UScriptStruct as an object reference
+			if (StructProperty->Struct == FInstancedStruct::StaticStruct())
+			{
+				return false;
+			}
+
+			for (TFieldIterator<FProperty> It(StructProperty->Struct); It; ++It)
+			{
+				if (!IsNetConnectionIndependent(*It))
+				{
+					return false;
+				}
+			}
+		}
+		else if (const FArrayProperty* ArrayProperty = CastField<FArrayProperty>(Property))
+		{
+			return IsNetConnectionIndependent(ArrayProperty->Inner);
+		}
+		else if (const FSetProperty* SetProperty = CastField<FSetProperty>(Property))
+		{
+			return IsNetConnectionIndependent(SetProperty->ElementProp);
+		}
+		else if (const FMapProperty* MapProperty = CastField<FMapProperty>(Property))
+		{
+			return IsNetConnectionIndependent(MapProperty->KeyProp) && IsNetConnectionIndependent(MapProperty->ValueProp);
+		}
+
+		return true;
+	}
+
+	/** False if no value of Property can own heap memory. Soft references hold a path string, so they count. */
+	static bool MayAllocate(const FProperty* Property)
+	{
+		if (const FStructProperty* StructProperty = CastField<FStructProperty>(Property))
+		{
+			if (StructProperty->Struct == FInstancedStruct::StaticStruct())
+			{
+				return true;
+			}
+
+			for (TFieldIterator<FProperty> It(StructProperty->Struct); It; ++It)
+			{
+				if (MayAllocate(*It))
+				{
+					return true;
+				}
+			}
+			return false;
+		}
+
+		if (Property->IsA<FSoftObjectProperty>())
+		{
+			return true;
+		}
+
+		return !(Property->IsA<FNumericProperty>() || Property->IsA<FBoolProperty>() || Property->IsA<FEnumProperty>()
+			|| Property->IsA<FNameProperty>() || Property->IsA<FObjectPropertyBase>());
+	}
+
+	static SIZE_T GetPropertyAllocatedSize(const FProperty* Property, const void* Value);
+
+	static SIZE_T GetStructAllocatedSize(const UStruct* Struct, const void* Data)
+	{
+		SIZE_T Size = 0;
+		for (TFieldIterator<FProperty> It(Struct); It; ++It)
+		{
+			for (int32 ArrayIndex = 0; ArrayIndex < It->ArrayDim; ++ArrayIndex)
+			{
+				Size += GetPropertyAllocatedSize(*It, It->ContainerPtrToValuePtr<void>(Data, ArrayIndex));
+			}
+		}
+		return Size;
+	}
+
+	static SIZE_T GetPropertyAllocatedSize(const FProperty* Property, const void* Value)
+	{
+		if (const FStrProperty* StrProperty = CastField<FStrProperty>(Property))
+		{
+			return StrProperty->GetPropertyValue(Value).GetAllocatedSize();
+		}
+
+		if (const FStructProperty* StructProperty = CastField<FStructProperty>(Property))
+		{
+			if (StructProperty->Struct == FInstancedStruct::StaticStruct())
+			{
+				return FNeoStructTraits::GetAllocatedSize(*static_cast<const FInstancedStruct*>(Value));
+			}
+			return FNeoStructTraits::Get(StructProperty->Struct).GetAllocatedSize(Value);
+		}
+
+		if (const FArrayProperty* ArrayProperty = CastField<FArrayProperty>(Property))
+		{
+			FScriptArrayHelper Helper(ArrayProperty, Value);
+			SIZE_T Size = static_cast<const FScriptArray*>(Value)->GetAllocatedSize(ArrayProperty->Inner->GetSize());
+			if (MayAllocate(ArrayProperty->Inner))
+			{
+				for (int32 Index = 0; Index < Helper.Num(); ++Index)
+				{
+					Size += GetPropertyAllocatedSize(ArrayProperty->Inner, Helper.GetRawPtr(Index));
+				}
+			}
+			return Size;
+		}
+
+		if (const FSetProperty* SetProperty = CastField<FSetProperty>(Property))
+		{
+			FScriptSetHelper Helper(SetProperty, Value);
+			SIZE_T Size = static_cast<SIZE_T>(Helper.GetMaxIndex()) * Helper.SetLayout.Size;
+			if (MayAllocate(SetProperty->ElementProp))
+			{
+				for (int32 Index = 0; Index < Helper.GetMaxIndex(); ++Index)
+				{
+					if (Helper.IsValidIndex(Index))
+					{
+						Size += GetPropertyAllocatedSize(SetProperty->ElementProp, Helper.GetElementPtr(Index));
+					}
+				}
+			}
+			return Size;
+		}
+
+		if (const FMapProperty* MapProperty = CastField<FMapProperty>(Property))
+		{
+			FScriptMapHelper Helper(MapProperty, Value);
+			SIZE_T Size = static_cast<SIZE_T>(Helper.GetMaxIndex()) * Helper.MapLayout.SetLayout.Size;
+			const bool bKeyMayAllocate = MayAllocate(MapProperty->KeyProp);
+			const bool bValueMayAllocate = MayAllocate(MapProperty->ValueProp);
+			if (bKeyMayAllocate || bValueMayAllocate)
+			{
+				for (int32 Index = 0; Index < Helper.GetMaxIndex(); ++Index)
+				{
+					if (!Helper.IsValidIndex(Index))
+					{
+						continue;
+					}
+					if (bKeyMayAllocate)
+					{
+						Size += GetPropertyAllocatedSize(MapProperty->KeyProp, Helper.GetKeyPtr(Index));
+					}
+					if (bValueMayAllocate)
+					{
+						Size += GetPropertyAllocatedSize(MapProperty->ValueProp, Helper.GetValuePtr(Index));
+					}
+				}
+			}
+			return Size;
+		}
+
+		if (const FSoftObjectProperty* SoftObjectProperty = CastField<FSoftObjectProperty>(Property))
+		{
+			return SoftObjectProperty->GetPropertyValue(Value).ToSoftObjectPath().GetSubPathString().GetAllocatedSize();
+		}
+
+		// Numbers, names, object references and text (shared, not owned) hold nothing we can attribute
+		return 0;
+	}
+}
+
+void FNeoStructTraits::Resolve(const UScriptStruct* InStruct)
+{
+	Struct = InStruct;
+	CppStructOps = InStruct->GetCppStructOps();
+	Size = InStruct->GetStructureSize();
+	bNativeHash = CppStructOps && CppStructOps->HasGetTypeHash();
+
+	bNetConnectionIndependent = InStruct != FInstancedStruct::StaticStruct();
+	for (TFieldIterator<FProperty> It(InStruct); It && bNetConnectionIndependent; ++It)
+	{
+		bNetConnectionIndependent = NeoDataStructTraits::IsNetConnectionIndependent(*It);
+	}
+
+	bMayAllocate = InStruct == FInstancedStruct::StaticStruct();
+	for (TFieldIterator<FProperty> It(InStruct); It && !bMayAllocate; ++It)
+	{
+		bMayAllocate = NeoDataStructTraits::MayAllocate(*It);
+	}
+
+	if (CppStructOps && CppStructOps->HasIdentical())
+	{
+		CompareMode = ENeoStructCompareMode::Native;
+	}
+	else if (NeoDataStructTraits::IsMemcmpSafe(InStruct))
+	{
+		CompareMode = ENeoStructCompareMode::Memcmp;
+	}
+	else
+	{
+		CompareMode = ENeoStructCompareMode::Reflection;
+	}
+}
+
+bool FNeoStructTraits::Identical(const void* A, const void* B) const
+{
+	switch (CompareMode)
+	{
+	case ENeoStructCompareMode::Memcmp:
+		return FMemory::Memcmp(A, B, Size) == 0;
+
+	case ENeoStructCompareMode::Native:
+		{
+			bool bResult = false;
+			if (CppStructOps->Identical(A, B, PPF_None, bResult))
+			{
+				return bResult;
+			}
+			break;
+		}
+
+	default:
+		break;
+	}
+
+	return Struct->CompareScriptStruct(A, B, PPF_None);
+}
+
+uint32 FNeoStructTraits::Hash(const void* Data) const
+{
+	const uint32 TypeHash = GetTypeHash(Struct);
+
+	if (bNativeHash)
+	{
+		return HashCombine(TypeHash, CppStructOps->GetStructTypeHash(Data));
+	}
+
+	switch (CompareMode)
+	{
+	case ENeoStructCompareMode::Memcmp:
+		return HashCombine(TypeHash, FCrc::MemCrc32(Data, Size));
+
+	case ENeoStructCompareMode::Reflection:
+		{
+			// Hash only properties that support it; skipping the rest keeps equal values equal
+			uint32 Hash = TypeHash;
+			for (TFieldIterator<FProperty> It(Struct); It; ++It)
+			{
+				const FProperty* Property = *It;
+				if (!Property->HasAllPropertyFlags(CPF_HasGetValueTypeHash))
+				{
+					continue;
+				}
+
+				for (int32 ArrayIndex = 0; ArrayIndex < Property->ArrayDim; ++ArrayIndex)
+				{
+					Hash = HashCombine(Hash, Property->GetValueTypeHash(Property->ContainerPtrToValuePtr<void>(Data, ArrayIndex)));
+				}
+			}
+			return Hash;
+		}
+
+	default:
+		// Native Identical without native hash: equality may be looser than the bytes
+		return TypeHash;
+	}
+}
+
+SIZE_T FNeoStructTraits::GetAllocatedSize(const void* Data) const
+{
+	if (!bMayAllocate)
+	{
+		return 0;
+	}
+
+	if (Struct == FInstancedStruct::StaticStruct())
+	{
+		return GetAllocatedSize(*static_cast<const FInstancedStruct*>(Data));
+	}
+
+	return NeoDataStructTraits::GetStructAllocatedSize(Struct, Data);
+}
+
+SIZE_T FNeoStructTraits::GetAllocatedSize(const FInstancedStruct& Value)
+{
+	const UScriptStruct* ValueStruct = Value.GetScriptStruct();
+	if (!ValueStruct || !Value.GetMemory())
+	{
+		return 0;
+	}
+
+	return ValueStruct->GetStructureSize() + Get(ValueStruct).GetAllocatedSize(Value.GetMemory());
+}
+
+const FNeoStructTraits& FNeoStructTraits::Get(const UScriptStruct* InStruct)
+{
+	check(InStruct);
+
+	{
+		FReadScopeLock ReadLock(NeoDataStructTraits::RegistryLock);
+		if (const TUniquePtr<FNeoStructTraits>* Found = NeoDataStructTraits::Registry.Find(InStruct))
+		{
+			return **Found;
+		}
+	}
+
+	FWriteScopeLock WriteLock(NeoDataStructTraits::RegistryLock);
+	TUniquePtr<FNeoStructTraits>& Traits = NeoDataStructTraits::Registry.FindOrAdd(InStruct);
+	if (!Traits)
+	{
+		Traits = MakeUnique<FNeoStructTraits>();
+		Traits->Resolve(InStruct);
+	}
+	return *Traits;
+}
@@ -2,6 +2,7 @@
 // Copyright 2025-2026 NeoNexus Studios. All Rights Reserved.
 
 #include "NeoDataSync.h"
+#include "NeoDataStaticCache.h"
 
 #define LOCTEXT_NAMESPACE "FNeoDataSyncModule"
 
@@ -14,6 +15,7 @@ void FNeoDataSyncModule::ShutdownModule()
 {
 	// This function may be called during shutdown to clean up your module.  For modules that support dynamic reloading,
 	// we call this function before unloading the module.
+	FNeoDataStaticCache::Get().Save();
 }
 
 #undef LOCTEXT_NAMESPACE
@@ -0,0 +1,72 @@
+// Copyright 2025-2026 NeoNexus Studios. All Rights Reserved.
+
+#include "NeoDataSyncLibrary.h"
+
+FRecordKey UNeoDataSyncLibrary::MakeNameKey(FName Name)
+{
+	return FRecordKey(Name);
+}
+
+FRecordKey UNeoDataSyncLibrary::MakeIntKey(int64 Value)
+{
+	return FRecordKey(Value);
+}
+
+FRecordKey UNeoDataSyncLibrary::MakeGuidKey(const FGuid& Guid)
+{
+	return FRecordKey(Guid);
+}
+
+FRecordKey UNeoDataSyncLibrary::MakeGameplayTagKey(FGameplayTag Tag)
+{
+	return FRecordKey(Tag);
+}
+
+bool UNeoDataSyncLibrary::GetNameFromKey(const FRecordKey& Key, FName& OutName)
+{
+	if (Key.Kind == ENeoRecordKeyKind::Name)
+	{
+		OutName = Key.NameKey;
+		return true;
+	}
+	return false;
+}
+
+bool UNeoDataSyncLibrary::GetIntFromKey(const FRecordKey& Key, int64& OutValue)
+{
+	if (Key.Kind == ENeoRecordKeyKind::Int)
+	{
+		OutValue = Key.IntKey;
+		return true;
+	}
+	return false;
+}
+
+bool UNeoDataSyncLibrary::GetGuidFromKey(const FRecordKey& Key, FGuid& OutGuid)
+{
+	FRecordKey NormalizedKey;
+	const FRecordKey& Normalized = Key.Normalize(NormalizedKey);
+	if (Normalized.Kind == ENeoRecordKeyKind::Guid)
+	{
+		OutGuid = Normalized.GuidKey;
+		return true;
+	}
+	return false;
+}
+
+bool UNeoDataSyncLibrary::GetGameplayTagFromKey(const FRecordKey& Key, FGameplayTag& OutTag)
+{
+	FRecordKey NormalizedKey;
+	const FRecordKey& Normalized = Key.Normalize(NormalizedKey);
+	if (Normalized.Kind == ENeoRecordKeyKind::GameplayTag)
+	{
+		OutTag = Normalized.TagKey;
+		return true;
+	}
+	return false;
+}
+
+FString UNeoDataSyncLibrary::Conv_RecordKeyToString(const FRecordKey& Key)
+{
+	return Key.ToString();
+}
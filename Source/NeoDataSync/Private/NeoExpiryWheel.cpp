@@ -0,0 +1,119 @@
+// Copyright 2025-2026 NeoNexus Studios. All Rights Reserved.
+
+#include "NeoExpiryWheel.h"
+
+FNeoExpiryWheel::FNeoExpiryWheel(double InResolution, double StartTime)
+	: Resolution(FMath::Max(InResolution, UE_KINDA_SMALL_NUMBER))
+	, CurrentTick(0)
+{
+	CurrentTick = ToTick(StartTime);
+}
+
+uint64 FNeoExpiryWheel::ToTick(double Time) const
+{
+	return Time <= 0.0 ? 0 : static_cast<uint64>(FMath::CeilToDouble(Time / Resolution));
+}
+
+void FNeoExpiryWheel::Schedule(const FRecordKey& Key, double ExpireTime)
+{
+	FNeoExpiryTimer Timer;
+	Timer.Key = Key;
+	Timer.ExpireTime = ExpireTime;
+
+	Insert(MoveTemp(Timer), ToTick(ExpireTime));
+	++NumTimers;
+}
+
+void FNeoExpiryWheel::Insert(FNeoExpiryTimer&& Timer, uint64 ExpireTick)
+{
+	// Already due: lands in the slot processed next
+	ExpireTick = FMath::Max(ExpireTick, CurrentTick);
+
+	// Beyond the top level's range: park at its furthest tick and re-insert from level 0 when it gets there
+	const uint64 MaxDelta = (uint64(1) << (SlotBits * NumLevels)) - 1;
+	const uint64 PlacementTick = FMath::Min(ExpireTick, CurrentTick + MaxDelta);
+	const uint64 Delta = PlacementTick - CurrentTick;
+
+	int32 Level = 0;
+	while (Level < NumLevels - 1 && Delta >= (uint64(1) << (SlotBits * (Level + 1))))
+	{
+		++Level;
+	}
+
+	const int32 SlotIndex = static_cast<int32>((PlacementTick >> (SlotBits * Level)) & SlotMask);
+
+	FSlotTimer& SlotTimer = Slots[Level][SlotIndex].AddDefaulted_GetRef();
+	SlotTimer.Timer = MoveTemp(Timer);
+	SlotTimer.ExpireTick = ExpireTick;
+}
+
+int32 FNeoExpiryWheel::Cascade(int32 Level, int32 SlotIndex)
+{
+	TArray<FSlotTimer> Pending = MoveTemp(Slots[Level][SlotIndex]);
+	Slots[Level][SlotIndex].Reset();
+
+	for (FSlotTimer& SlotTimer : Pending)
+	{
+		Insert(MoveTemp(SlotTimer.Timer), SlotTimer.ExpireTick);
+	}
+	return SlotIndex;
+}
+
+void FNeoExpiryWheel::Advance(double Now, TArray<FNeoExpiryTimer>& OutExpired)
+{
+	// Only ticks whose whole width has passed are processed, so nothing pops before its ExpireTime
+	const double NowTicks = Now / Resolution;
+	if (NowTicks < 0.0)
+	{
+		return;
+	}
+	const uint64 TargetTick = static_cast<uint64>(FMath::FloorToDouble(NowTicks));
+
+	if (NumTimers == 0)
+	{
+		CurrentTick = FMath::Max(CurrentTick, TargetTick + 1);
+		return;
+	}
+
+	while (CurrentTick <= TargetTick && NumTimers > 0)
+	{
+		const int32 Index = static_cast<int32>(CurrentTick & SlotMask);
+
+		// Entering a new level-0 lap: pull the matching slot of each higher level down, stopping at the first non-wrap
+		if (Index == 0)
+		{
+			for (int32 Level = 1; Level < NumLevels; ++Level)
+			{
+				const int32 LevelIndex = static_cast<int32>((CurrentTick >> (SlotBits * Level)) & SlotMask);
+				if (Cascade(Level, LevelIndex) != 0)
+				{
+					break;
+				}
+			}
+		}
+
+		TArray<FSlotTimer> Slot = MoveTemp(Slots[0][Index]);
+		Slots[0][Index].Reset();
+
+		for (FSlotTimer& SlotTimer : Slot)
+		{
+			if (SlotTimer.ExpireTick <= CurrentTick)
+			{
+				OutExpired.Add(MoveTemp(SlotTimer.Timer));
+				--NumTimers;
+			}
+			else
+			{
+				// Parked beyond the wheel's range; schedule the remainder
+				Insert(MoveTemp(SlotTimer.Timer), SlotTimer.ExpireTick);
+			}
+		}
+
+		++CurrentTick;
+	}
+
+	if (NumTimers == 0)
+	{
+		CurrentTick = FMath::Max(CurrentTick, TargetTick + 1);
+	}
+}
@@ -2,196 +2,4023 @@
 
 #include "NeoReplicatedData.h"
 #include "Net/UnrealNetwork.h"
+#include "Net/RepLayout.h"
+#include "UObject/CoreNet.h"
+#include "Engine/NetDriver.h"
+#include "Engine/NetConnection.h"
+#include "Engine/DemoNetDriver.h"
+#include "NeoDataKeyScan.h"
+#include "NeoExpiryWheel.h"
+#include "NeoDataInterpolation.h"
+#include "NeoDataHistory.h"
+#include "NeoDataChangeStream.h"
+#include "NeoDataLoadTracker.h"
+#include "NeoDataDigest.h"
+#include "NeoDataReconnect.h"
+#include "NeoDataReconnectCache.h"
+#include "NeoDataStaticCache.h"
+#include "NeoDataDefaultsAsset.h"
+#include "GameFramework/GameStateBase.h"
+#include "GameFramework/PlayerState.h"
+#include "GameFramework/Pawn.h"
+#include "GameFramework/Controller.h"
+#include "TimerManager.h"
+
+DECLARE_STATS_GROUP(TEXT("NeoDataSync"), STATGROUP_NeoDataSync, STATCAT_Advanced);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Suppressed Writes"), STAT_NeoData_SuppressedWrites, STATGROUP_NeoDataSync);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Shared Payload Hits"), STAT_NeoData_SharedPayloadHits, STATGROUP_NeoDataSync);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Shared Payload Misses"), STAT_NeoData_SharedPayloadMisses, STATGROUP_NeoDataSync);
+DECLARE_CYCLE_STAT(TEXT("NetDeltaSerialize"), STAT_NeoData_NetDeltaSerialize, STATGROUP_NeoDataSync);
+DECLARE_CYCLE_STAT(TEXT("BulkLoad"), STAT_NeoData_BulkLoad, STATGROUP_NeoDataSync);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Compactions"), STAT_NeoData_Compactions, STATGROUP_NeoDataSync);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Compaction Reclaimed Bytes"), STAT_NeoData_CompactionReclaimedBytes, STATGROUP_NeoDataSync);
+
+LLM_DEFINE_TAG(NeoDataSync);
+
+static int32 GNeoDataHashIndexThreshold = 64;
+static FAutoConsoleVariableRef CVarNeoDataHashIndexThreshold(
+	TEXT("NeoData.HashIndexThreshold"),
+	GNeoDataHashIndexThreshold,
+	TEXT("Maps with at least this many entries look keys up through a hash index; smaller maps use a vectorized hash scan."));
+
+static bool GNeoDataSharePayloads = true;
+static FAutoConsoleVariableRef CVarNeoDataSharePayloads(
+	TEXT("NeoData.SharePayloads"),
+	GNeoDataSharePayloads,
+	TEXT("Encode each dirty entry payload once per net update and reuse the bits for every connection."));
+
+static float GNeoDataCompactLoadFactor = 0.25f;
+static FAutoConsoleVariableRef CVarNeoDataCompactLoadFactor(
+	TEXT("NeoData.CompactLoadFactor"),
+	GNeoDataCompactLoadFactor,
+	TEXT("Maps whose entries fill less than this fraction of their capacity are compacted. 0 disables compaction."));
+
+static int32 GNeoDataCompactMinSlackBytes = 16 * 1024;
+static FAutoConsoleVariableRef CVarNeoDataCompactMinSlackBytes(
+	TEXT("NeoData.CompactMinSlackBytes"),
+	GNeoDataCompactMinSlackBytes,
+	TEXT("Unused map capacity below this many bytes is never worth compacting."));
+
+static int32 GNeoDataCompactBudgetBytes = 256 * 1024;
+static FAutoConsoleVariableRef CVarNeoDataCompactBudgetBytes(
+	TEXT("NeoData.CompactBudgetBytes"),
+	GNeoDataCompactBudgetBytes,
+	TEXT("Bytes of entries all maps together may copy while compacting per frame. The first compaction of a frame always runs."));
+
+static int32 GNeoDataStaticEntriesPerRPC = 64;
+static FAutoConsoleVariableRef CVarNeoDataStaticEntriesPerRPC(
+	TEXT("NeoData.StaticEntriesPerRPC"),
+	GNeoDataStaticEntriesPerRPC,
+	TEXT("Static values per request and per reply RPC, keeping each RPC well within a reliable bunch."));
+
+static int32 GNeoDataDigestDrillDepth = 4;
+static FAutoConsoleVariableRef CVarNeoDataDigestDrillDepth(
+	TEXT("NeoData.DigestDrillDepth"),
+	GNeoDataDigestDrillDepth,
+	TEXT("Levels of the state digest tree the server returns below each mismatched node: fewer round trips, more hashes per reply."));
+
+static int32 GNeoDataDigestMaxNodes = 1024;
+static FAutoConsoleVariableRef CVarNeoDataDigestMaxNodes(
+	TEXT("NeoData.DigestMaxNodes"),
+	GNeoDataDigestMaxNodes,
+	TEXT("Most state digest nodes the server compares per client request, and returns per reply; the rest are ignored."));
+
+static int32 GNeoDataDigestMaxRequests = 16;
+static FAutoConsoleVariableRef CVarNeoDataDigestMaxRequests(
+	TEXT("NeoData.DigestMaxRequests"),
+	GNeoDataDigestMaxRequests,
+	TEXT("State digest requests the server answers per connection within NeoData.DigestRequestWindow. A check of the largest digest takes five."));
+
+static float GNeoDataDigestRequestWindow = 10.0f;
+static FAutoConsoleVariableRef CVarNeoDataDigestRequestWindow(
+	TEXT("NeoData.DigestRequestWindow"),
+	GNeoDataDigestRequestWindow,
+	TEXT("Seconds over which NeoData.DigestMaxRequests is counted."));
+
+namespace NeoReplicatedData
+{
+	/** Payload body without the struct type: native NetSerialize or the struct's rep layout, as FInstancedStruct does. */
+	static void NetSerializePayloadBody(FArchive& Ar, UPackageMap* Map, UScriptStruct* Struct, void* Memory, bool& bOutSuccess)
+	{
+		if (EnumHasAnyFlags(Struct->StructFlags, STRUCT_NetSerializeNative))
+		{
+			Struct->GetCppStructOps()->NetSerialize(Ar, Map, bOutSuccess, Memory);
+			return;
+		}
+
+		UNetDriver* NetDriver = Map ? Map->GetNetDriver() : nullptr;
+		TSharedPtr<FRepLayout> RepLayout = NetDriver ? NetDriver->GetStructRepLayout(Struct) : nullptr;
+		if (!RepLayout.IsValid())
+		{
+			bOutSuccess = false;
+			return;
+		}
+
+		bool bHasUnmapped = false;
+		RepLayout->SerializePropertiesForStruct(Struct, static_cast<FBitArchive&>(Ar), Map, Memory, bHasUnmapped);
+	}
+
+	static thread_local FNeoDataMap* SerializingMap = nullptr;
+}
 
 // ------------------------------------------------------------------------------------------------
-// FNeoDataEntry
+// FRecordKey
 // ------------------------------------------------------------------------------------------------
 
-void FNeoDataEntry::PreReplicatedRemove(const FNeoDataMap& InArraySerializer) const
+FRecordKey::FRecordKey(const FInstancedStruct& InKeyData)
 {
-	if (InArraySerializer.Owner)
+	const UScriptStruct* ScriptStruct = InKeyData.GetScriptStruct();
+	if (ScriptStruct == TBaseStructure<FGuid>::Get())
 	{
-		InArraySerializer.Owner->NotifyKeyRemoved(Key);
+		Kind = ENeoRecordKeyKind::Guid;
+		GuidKey = InKeyData.Get<FGuid>();
+	}
+	else if (ScriptStruct == FGameplayTag::StaticStruct())
+	{
+		Kind = ENeoRecordKeyKind::GameplayTag;
+		TagKey = InKeyData.Get<FGameplayTag>();
+	}
+	else
+	{
+		KeyData = InKeyData;
 	}
 }
 
-void FNeoDataEntry::PostReplicatedAdd(const FNeoDataMap& InArraySerializer) const
+const FRecordKey& FRecordKey::Normalize(FRecordKey& Scratch) const
 {
-	if (InArraySerializer.Owner)
+	if (Kind == ENeoRecordKeyKind::Struct)
 	{
-		InArraySerializer.Owner->NotifyKeyAdded(Key, Value);
+		const UScriptStruct* ScriptStruct = KeyData.GetScriptStruct();
+		if (ScriptStruct == TBaseStructure<FGuid>::Get() || ScriptStruct == FGameplayTag::StaticStruct())
+		{
+			Scratch = FRecordKey(KeyData);
+			return Scratch;
+		}
 	}
+	return *this;
 }
 
-void FNeoDataEntry::PostReplicatedChange(const FNeoDataMap& InArraySerializer) const
+FString FRecordKey::ToString() const
 {
-	if (InArraySerializer.Owner)
+	switch (Kind)
+	{
+	case ENeoRecordKeyKind::Name:			return NameKey.ToString();
+	case ENeoRecordKeyKind::Int:			return LexToString(IntKey);
+	case ENeoRecordKeyKind::Guid:			return GuidKey.ToString();
+	case ENeoRecordKeyKind::GameplayTag:	return TagKey.ToString();
+	case ENeoRecordKeyKind::Transaction:	return FString::Printf(TEXT("Transaction_%lld"), IntKey);
+	default:								break;
+	}
+
+	const UScriptStruct* ScriptStruct = KeyData.GetScriptStruct();
+	if (!ScriptStruct)
+	{
+		return TEXT("None");
+	}
+
+	FString Text;
+	ScriptStruct->ExportText(Text, KeyData.GetMemory(), nullptr, nullptr, PPF_None, nullptr);
+	return FString::Printf(TEXT("%s%s"), *ScriptStruct->GetName(), *Text);
+}
+
+bool FRecordKey::NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess)
+{
+	bOutSuccess = true;
+
+	uint8 KindBits = static_cast<uint8>(Kind);
+	Ar.SerializeBits(&KindBits, 3);
+
+	if (Ar.IsLoading())
 	{
-		InArraySerializer.Owner->NotifyKeyUpdated(Key, Value);
+		*this = FRecordKey();
+		Kind = static_cast<ENeoRecordKeyKind>(KindBits);
+	}
+
+	switch (Kind)
+	{
+	case ENeoRecordKeyKind::Struct:
+		return KeyData.NetSerialize(Ar, Map, bOutSuccess);
+
+	case ENeoRecordKeyKind::Name:
+		// Net archives route FName through the package map
+		Ar << NameKey;
+		break;
+
+	case ENeoRecordKeyKind::Int:
+	case ENeoRecordKeyKind::Transaction:
+		{
+			// ZigZag so small negative ids stay small when packed
+			uint64 Packed = (static_cast<uint64>(IntKey) << 1) ^ static_cast<uint64>(IntKey >> 63);
+			Ar.SerializeIntPacked64(Packed);
+			IntKey = static_cast<int64>(Packed >> 1) ^ -static_cast<int64>(Packed & 1);
+			break;
+		}
+
+	case ENeoRecordKeyKind::Guid:
+		GuidKey.NetSerialize(Ar, Map, bOutSuccess);
+		break;
+
+	case ENeoRecordKeyKind::GameplayTag:
+		TagKey.NetSerialize(Ar, Map, bOutSuccess);
+		break;
+
+	default:
+		bOutSuccess = false;
+		break;
 	}
+
+	return true;
 }
 
 // ------------------------------------------------------------------------------------------------
-// FNeoDataMap
+// FNeoDataEntry
 // ------------------------------------------------------------------------------------------------
 
-void FNeoDataMap::AddOrUpdate(const FRecordKey& Key, const FRecordDefinition& Value)
+bool FNeoDataEntry::NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess)
 {
-	FNeoDataEntry* ExistingEntry = Items.FindByPredicate([&Key](const FNeoDataEntry& Entry)
+	bOutSuccess = true;
+
+	// Loading in place: nonzero for an entry the client already held
+	const int64 PreviousVersion = Version;
+
+	Key.NetSerialize(Ar, Map, bOutSuccess);
+	Ar << Flags;
+	Ar.SerializeIntPacked(VolatileSequence);
+
+	uint64 PackedVersion = static_cast<uint64>(Version);
+	Ar.SerializeIntPacked64(PackedVersion);
+	Version = static_cast<int64>(PackedVersion);
+
+	uint32 PackedTransactionId = static_cast<uint32>(TransactionId);
+	Ar.SerializeIntPacked(PackedTransactionId);
+	TransactionId = static_cast<int32>(PackedTransactionId);
+
+	// Readers keep the value from before a transaction until all of it has arrived; Value is still the old one here
+	FNeoDataMap* OwningMap = NeoReplicatedData::SerializingMap;
+	if (Ar.IsLoading() && OwningMap && !Key.IsTransaction() && (TransactionId != 0 || OwningMap->HasTransactionShadows()))
 	{
-		return Entry.Key == Key;
-	});
+		OwningMap->ShadowReceivedEntry(*this, PreviousVersion);
+	}
 
-	if (ExistingEntry)
+	uint8 bHasExpiry = ExpireTime > 0.0;
+	Ar.SerializeBits(&bHasExpiry, 1);
+	if (bHasExpiry)
 	{
-		// Update
-		ExistingEntry->Value = Value;
-		MarkItemDirty(*ExistingEntry);
-		
-		// Notify Local
-		if (Owner)
+		Ar << ExpireTime;
+	}
+	else if (Ar.IsLoading())
+	{
+		ExpireTime = 0.0;
+	}
+
+	// Static: the hash always travels; connections that can request values get nothing else
+	if (HasFlags(ENeoDataEntryFlags::Static))
+	{
+		Ar << StaticHash;
+
+		uint8 bStaticStub = Ar.IsSaving() && OwningMap && OwningMap->bWritingStaticStubs;
+		Ar.SerializeBits(&bStaticStub, 1);
+		if (bStaticStub)
 		{
-			Owner->NotifyKeyUpdated(Key, Value);
+			if (Ar.IsSaving())
+			{
+				++OwningMap->Stats.StaticStubsSent;
+				return true;
+			}
+
+			// Keep a held value whose hash still matches; otherwise try the disk cache
+			bAwaitingStatic = false;
+			if (Value.Payload.IsValid() && FNeoDataStaticCache::HashValue(Value.Payload) == StaticHash)
+			{
+				return true;
+			}
+			if (FNeoDataStaticCache::Get().Find(StaticHash, Value.Payload))
+			{
+				if (OwningMap)
+				{
+					++OwningMap->Stats.StaticCacheHits;
+				}
+				return true;
+			}
+			bAwaitingStatic = true;
+			return true;
 		}
 	}
-	else
+	else if (Ar.IsLoading())
 	{
-		// Add
-		FNeoDataEntry& NewEntry = Items.Add_GetRef(FNeoDataEntry(Key, Value));
-		MarkItemDirty(NewEntry);
-		
-		// Notify Local
-		if (Owner)
+		StaticHash = 0;
+	}
+	if (Ar.IsLoading())
+	{
+		bAwaitingStatic = false;
+	}
+
+	// Payload: valid bit and struct type are per connection (the type is an object reference), the body may be shared
+	FInstancedStruct& Payload = Value.Payload;
+	uint8 bValidPayload = Ar.IsSaving() ? Payload.IsValid() : 0;
+	Ar.SerializeBits(&bValidPayload, 1);
+
+	if (!bValidPayload)
+	{
+		if (Ar.IsLoading())
+		{
+			Payload.Reset();
+		}
+		return true;
+	}
+
+	UScriptStruct* PayloadStruct = const_cast<UScriptStruct*>(Payload.GetScriptStruct());
+	Ar << PayloadStruct;
+
+	if (Ar.IsLoading())
+	{
+		if (Payload.GetScriptStruct() != PayloadStruct)
+		{
+			Payload.InitializeAs(PayloadStruct);
+		}
+		if (!PayloadStruct)
 		{
-			Owner->NotifyKeyAdded(Key, Value);
+			// The body follows without a length, so the rest of the bunch can't be read past it
+			UE_LOG(LogTemp, Error, TEXT("[NeoDataSync] Unresolved payload struct for key %s, rejecting the bunch"), *Key.ToString());
+			Ar.SetError();
+			bOutSuccess = false;
+			return false;
 		}
+		NeoReplicatedData::NetSerializePayloadBody(Ar, Map, PayloadStruct, Payload.GetMutableMemory(), bOutSuccess);
+		return true;
+	}
+
+	if (!OwningMap || !GNeoDataSharePayloads || ReplicationID == INDEX_NONE
+		|| !FNeoStructTraits::Get(PayloadStruct).bNetConnectionIndependent)
+	{
+		NeoReplicatedData::NetSerializePayloadBody(Ar, Map, PayloadStruct, Payload.GetMutableMemory(), bOutSuccess);
+		return true;
+	}
+
+	// Volatile writes change the value without bumping ReplicationKey, so both identify the revision
+	FNeoSharedPayloadBits& Shared = OwningMap->SharedPayloads.FindOrAdd(ReplicationID);
+	const bool bCached = Shared.ReplicationKey == ReplicationKey
+		&& Shared.VolatileSequence == VolatileSequence
+		&& Shared.EngineNetVer == Ar.EngineNetVer()
+		&& Shared.GameNetVer == Ar.GameNetVer();
+
+	if (bCached)
+	{
+		++OwningMap->Stats.SharedPayloadHits;
+		INC_DWORD_STAT(STAT_NeoData_SharedPayloadHits);
 	}
+	else
+	{
+		FNetBitWriter Writer(Map, 0);
+		Writer.SetEngineNetVer(Ar.EngineNetVer());
+		Writer.SetGameNetVer(Ar.GameNetVer());
+		NeoReplicatedData::NetSerializePayloadBody(Writer, Map, PayloadStruct, Payload.GetMutableMemory(), bOutSuccess);
+
+		Shared.Data = *Writer.GetBuffer();
+		Shared.NumBits = Writer.GetNumBits();
+		Shared.ReplicationKey = ReplicationKey;
+		Shared.VolatileSequence = VolatileSequence;
+		Shared.EngineNetVer = Ar.EngineNetVer();
+		Shared.GameNetVer = Ar.GameNetVer();
+
+		++OwningMap->Stats.SharedPayloadMisses;
+		INC_DWORD_STAT(STAT_NeoData_SharedPayloadMisses);
+	}
+
+	Ar.SerializeBits(Shared.Data.GetData(), Shared.NumBits);
+	return true;
 }
 
-void FNeoDataMap::Remove(const FRecordKey& Key)
+void FNeoDataEntry::PreReplicatedRemove(const FNeoDataMap& InArraySerializer) const
 {
-	for (auto It = Items.CreateIterator(); It; ++It)
+	InArraySerializer.InvalidateKeyCache();
+	InArraySerializer.RemoveDigest(*this);
+
+	// A removed override falls back to the baked default; the owner settles which once the receive is complete.
+	// Its handles carry over to the default entry if one comes back.
+	if (InArraySerializer.Defaults && InArraySerializer.Defaults->Contains(Key))
 	{
-		if (It->Key == Key)
+		const int32 HandleSlot = InArraySerializer.DetachHandle(*this);
+		if (HandleSlot != INDEX_NONE)
 		{
-			// Notify Local before removal
-			if (Owner)
+			if (const int32* PreviousSlot = InArraySerializer.PendingDefaultHandles.Find(Key))
 			{
-				Owner->NotifyKeyRemoved(Key);
+				InArraySerializer.ReleaseHandleSlot(*PreviousSlot);
 			}
-
-			It.RemoveCurrent();
-			MarkArrayDirty();
-			return;
+			InArraySerializer.PendingDefaultHandles.Add(Key, HandleSlot);
 		}
+		InArraySerializer.PendingDefaultKeys.Emplace(Key, true);
+		return;
+	}
+
+	// Its transaction may hold the removal back from readers; the owner decides once the receive is complete
+	if (InArraySerializer.Owner && !Key.IsTransaction())
+	{
+		InArraySerializer.ShadowRemovedEntry(*this);
+	}
+	InArraySerializer.ReleaseHandle(*this);
+
+	if (InArraySerializer.Owner)
+	{
+		InArraySerializer.Owner->NotifyKeyRemoved(Key);
 	}
 }
 
-const FRecordDefinition* FNeoDataMap::Find(const FRecordKey& Key) const
+void FNeoDataEntry::PostReplicatedAdd(const FNeoDataMap& InArraySerializer) const
 {
-	const FNeoDataEntry* Entry = Items.FindByPredicate([&Key](const FNeoDataEntry& Item)
+	InArraySerializer.InvalidateKeyCache();
+	InArraySerializer.UpdateDigest(*this);
+
+	// Overrides a baked default: the local default entry goes, and the owner announces the key as added or updated
+	const bool bOverridesDefault = InArraySerializer.Defaults && InArraySerializer.Defaults->Contains(Key);
+	if (bOverridesDefault)
 	{
-		return Item.Key == Key;
-	});
-	return Entry ? &Entry->Value : nullptr;
+		InArraySerializer.PendingDefaultKeys.Emplace(Key, false);
+	}
+
+	// Announced once its value has been fetched
+	if (bAwaitingStatic && InArraySerializer.Owner)
+	{
+		bStaticAddPending = true;
+		InArraySerializer.Owner->RequestStaticEntry(StaticHash);
+		return;
+	}
+
+	if (InArraySerializer.Owner && !bOverridesDefault)
+	{
+		InArraySerializer.Owner->NotifyKeyAdded(Key, Value, TransactionId);
+	}
 }
 
-FRecordDefinition* FNeoDataMap::Find(const FRecordKey& Key)
+void FNeoDataEntry::PostReplicatedChange(const FNeoDataMap& InArraySerializer) const
 {
-	FNeoDataEntry* Entry = Items.FindByPredicate([&Key](const FNeoDataEntry& Item)
+	InArraySerializer.UpdateDigest(*this);
+
+	if (bAwaitingStatic && InArraySerializer.Owner)
 	{
-		return Item.Key == Key;
-	});
-	return Entry ? &Entry->Value : nullptr;
+		InArraySerializer.Owner->RequestStaticEntry(StaticHash);
+		return;
+	}
+
+	if (InArraySerializer.Owner)
+	{
+		InArraySerializer.Owner->NotifyKeyUpdated(Key, Value, TransactionId);
+	}
 }
 
 // ------------------------------------------------------------------------------------------------
-// UNeoReplicatedDataComponent
+// FNeoDataMap
 // ------------------------------------------------------------------------------------------------
 
-UNeoReplicatedDataComponent::UNeoReplicatedDataComponent()
+bool FNeoDataMap::NetDeltaSerialize(FNetDeltaSerializeInfo& DeltaParms)
 {
-	SetIsReplicatedByDefault(true);
-	DataMap.Owner = this;
-}
+	SCOPE_CYCLE_COUNTER(STAT_NeoData_NetDeltaSerialize);
+	LLM_SCOPE_BYTAG(NeoDataSync);
 
-void UNeoReplicatedDataComponent::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
-{
-	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
+	if (DeltaParms.Writer && SharedPayloadsFrame != GFrameCounter)
+	{
+		// Encodings are only shared within one net update; keep the slack for the next one
+		SharedPayloads.Reset();
+		SharedPayloadsFrame = GFrameCounter;
+	}
 
-	DOREPLIFETIME(UNeoReplicatedDataComponent, DataMap);
-}
+	// Replay checkpoints are measured so map size can be weighed against checkpoint size
+	const bool bReplayCheckpoint = DeltaParms.Writer && DeltaParms.Connection && DeltaParms.Connection->IsReplay()
+		&& DeltaParms.Connection->GetResendAllDataState() != EResendAllDataState::None;
+	const int64 StartBits = bReplayCheckpoint ? DeltaParms.Writer->GetNumBits() : 0;
 
-void UNeoReplicatedDataComponent::SetData(const FRecordKey& Key, const FRecordDefinition& Value)
-{
-	// 1. Validate Key Type
-	if (RestrictedKeyType)
+	// Delta checkpoints (demo.DeltaCheckpoints) are applied on top of the previous ones when scrubbing, so they only
+	// need the entries added, changed or removed since the last checkpoint: diff against that checkpoint's base state
+	const bool bDeltaCheckpoint = bReplayCheckpoint && CheckpointBaseState.IsValid()
+		&& DeltaParms.Connection->GetResendAllDataState() == EResendAllDataState::SinceCheckpoint;
+	TSharedPtr<INetDeltaBaseState> CheckpointNewState;
+	TGuardValue<INetDeltaBaseState*> CheckpointOldStateGuard(DeltaParms.OldState, bDeltaCheckpoint ? CheckpointBaseState.Get() : DeltaParms.OldState);
+	TGuardValue<TSharedPtr<INetDeltaBaseState>*> CheckpointNewStateGuard(DeltaParms.NewState,
+		bReplayCheckpoint && !DeltaParms.NewState ? &CheckpointNewState : DeltaParms.NewState);
+
+	// Entries a digest check found divergent go to the connection that asked, and only to it
+	const TSharedPtr<INetDeltaBaseState> RepairState = DeltaParms.Writer && Owner && !bReplayCheckpoint
+		? Owner->TakeDigestRepairState(DeltaParms.Connection, DeltaParms.OldState) : nullptr;
+	TGuardValue<INetDeltaBaseState*> RepairStateGuard(DeltaParms.OldState, RepairState ? RepairState.Get() : DeltaParms.OldState);
+
+	const bool bReplayScrub = DeltaParms.Reader && Owner && Owner->IsApplyingReplayScrub();
+	const bool bLoadTiming = Owner && (DeltaParms.Reader || DeltaParms.Writer) && Owner->NeedsLoadTiming(DeltaParms.Reader != nullptr);
+	const double StartTime = bReplayScrub || bLoadTiming ? FPlatformTime::Seconds() : 0.0;
+
+	// Position in the bunch being read or written; the difference is this map's share of it
+	auto GetBitPosition = [&DeltaParms]() -> int64
 	{
-		const UScriptStruct* KeyStruct = Key.KeyData.GetScriptStruct();
-		if (KeyStruct != RestrictedKeyType)
-		{
-			UE_LOG(LogTemp, Warning, TEXT("[NeoDataSync] SetData Failed: Key type '%s' does not match RestrictedKeyType '%s' on Component '%s'"), 
-				*GetNameSafe(KeyStruct), 
-				*GetNameSafe(RestrictedKeyType),
-				*GetNameSafe(this));
-			return;
-		}
+		return DeltaParms.Reader ? DeltaParms.Reader->GetPosBits() : DeltaParms.Writer ? DeltaParms.Writer->GetNumBits() : 0;
+	};
+	const int64 StartPosition = GetBitPosition();
+
+	// Item callbacks queue their notifications; the owner sorts them into transactions once the whole delta is applied
+	const bool bReceiving = DeltaParms.Reader && Owner;
+	if (bReceiving)
+	{
+		Owner->BeginReplicatedReceive();
 	}
 
-	// 2. Validate Value Type
-	if (RestrictedValueType)
+	// A reconnecting client's first send skips what its cache holds
+	FNeoDataResyncFilter Filter;
+	const bool bResync = DeltaParms.Writer && Owner && Owner->BeginResyncSend(DeltaParms.Connection, DeltaParms.OldState == nullptr, Filter);
+
+	// Version stamps: what the client must already hold for this send to apply, and what it holds afterwards.
+	// A withheld send delivers nothing, so it vouches for no more than its base. Only maps that resync reconnecting
+	// clients carry them, and never replays, so other bunches and recorded replays keep their layout.
+	const bool bVersionStamps = Owner && Owner->bEnableReconnectResync && !DeltaParms.bInternalAck;
+	uint64 BaseVersion = 0;
+	uint64 NewVersion = 0;
+	if (bVersionStamps && DeltaParms.Writer)
 	{
-		const UScriptStruct* ValueStruct = Value.Payload.GetScriptStruct();
-		if (ValueStruct != RestrictedValueType)
+		BaseVersion = DeltaParms.OldState ? static_cast<const FNeoDataBaseState*>(DeltaParms.OldState)->Version : 0;
+		NewVersion = bResync && Filter.bWithholdAll ? BaseVersion : LastVersion;
+		DeltaParms.Writer->SerializeIntPacked64(BaseVersion);
+		DeltaParms.Writer->SerializeIntPacked64(NewVersion);
+	}
+	else if (bVersionStamps && DeltaParms.Reader)
+	{
+		DeltaParms.Reader->SerializeIntPacked64(BaseVersion);
+		DeltaParms.Reader->SerializeIntPacked64(NewVersion);
+	}
+
+	bool bResult;
+	{
+		TGuardValue<FNeoDataMap*> SerializingGuard(NeoReplicatedData::SerializingMap, this);
+		TGuardValue<FNeoDataResyncFilter*> FilterGuard(ResyncFilter, bResync ? &Filter : nullptr);
+		TGuardValue<bool> StaticStubsGuard(bWritingStaticStubs, DeltaParms.Writer && Owner && Owner->CanSendStaticStubs(DeltaParms.Connection));
+		bResult = FastArrayDeltaSerialize<FNeoDataEntry, FNeoDataMap>(Items, DeltaParms, *this);
+	}
+
+	if (bVersionStamps && DeltaParms.Writer && DeltaParms.NewState && DeltaParms.NewState->IsValid())
+	{
+		// Stamp the new base state; moving the id map keeps this O(1)
+		FNetFastTArrayBaseState* Unstamped = static_cast<FNetFastTArrayBaseState*>(DeltaParms.NewState->Get());
+		TSharedPtr<FNeoDataBaseState> Stamped = MakeShared<FNeoDataBaseState>();
+		Stamped->IDToCLMap = MoveTemp(Unstamped->IDToCLMap);
+		Stamped->ArrayReplicationKey = Unstamped->ArrayReplicationKey;
+		Stamped->Version = static_cast<int64>(NewVersion);
+		*DeltaParms.NewState = Stamped;
+	}
+	else if (bVersionStamps && DeltaParms.Reader && !DeltaParms.Reader->IsError() && static_cast<int64>(BaseVersion) <= ReceivedVersion)
+	{
+		ReceivedVersion = FMath::Max(ReceivedVersion, static_cast<int64>(NewVersion));
+	}
+
+	if (bResync)
+	{
+		Owner->EndResyncSend(DeltaParms.Connection, DeltaParms, Filter);
+	}
+
+	if (bReceiving)
+	{
+		Owner->EndReplicatedReceive();
+	}
+
+	const int64 Bytes = (GetBitPosition() - StartPosition + 7) / 8;
+	if (DeltaParms.Reader)
+	{
+		Stats.BytesReceived += Bytes;
+	}
+	else
+	{
+		Stats.BytesSent += Bytes;
+	}
+
+	if (bReplayCheckpoint)
+	{
+		++Stats.ReplayCheckpoints;
+		Stats.ReplayCheckpointBytes += (DeltaParms.Writer->GetNumBits() - StartBits + 7) / 8;
+		if (bDeltaCheckpoint)
 		{
-			UE_LOG(LogTemp, Warning, TEXT("[NeoDataSync] SetData Failed: Value type '%s' does not match RestrictedValueType '%s' on Component '%s'"), 
-				*GetNameSafe(ValueStruct), 
-				*GetNameSafe(RestrictedValueType),
-				*GetNameSafe(this));
-			return;
+			++Stats.ReplayDeltaCheckpoints;
+		}
+
+		// Without a new state nothing changed since the last checkpoint, whose state stays the base
+		if (DeltaParms.NewState && DeltaParms.NewState->IsValid())
+		{
+			CheckpointBaseState = *DeltaParms.NewState;
 		}
 	}
+	if (bReplayScrub)
+	{
+		Stats.ReplayScrubMicroseconds += static_cast<int64>((FPlatformTime::Seconds() - StartTime) * 1.0e6);
+	}
+	if (bLoadTiming)
+	{
+		Owner->RecordNetDeltaSerialize(DeltaParms.Reader != nullptr, FPlatformTime::Seconds() - StartTime, Bytes);
+	}
 
-	DataMap.AddOrUpdate(Key, Value);
+	return bResult;
 }
 
-void UNeoReplicatedDataComponent::RemoveData(const FRecordKey& Key)
+FNeoDataMap* FNeoDataMap::GetSerializingMap()
 {
-	DataMap.Remove(Key);
+	return NeoReplicatedData::SerializingMap;
 }
 
-bool UNeoReplicatedDataComponent::GetData(const FRecordKey& Key, FRecordDefinition& OutValue) const
+void FNeoDataMap::RefreshKeyHashes() const
 {
-	if (const FRecordDefinition* Found = DataMap.Find(Key))
+	// Num check is a safety net for code that edits Items directly
+	if (!bKeyHashesDirty && KeyHashes.Num() == Items.Num())
 	{
-		OutValue = *Found;
-		return true;
+		return;
 	}
-	return false;
+
+	KeyHashes.SetNumUninitialized(Items.Num());
+	for (int32 Index = 0; Index < Items.Num(); ++Index)
+	{
+		KeyHashes[Index] = GetTypeHash(Items[Index].Key);
+	}
+	bKeyHashesDirty = false;
+	bKeyIndexValid = false;
 }
 
-TArray<FRecordKey> UNeoReplicatedDataComponent::GetKeys() const
+void FNeoDataMap::RefreshKeyIndex() const
 {
-	TArray<FRecordKey> Keys;
-	Keys.Reserve(DataMap.Items.Num());
-	for (const FNeoDataEntry& Entry : DataMap.Items)
+	// Keep chains short: rebuild when the map outgrows twice the bucket count
+	if (bKeyIndexValid && static_cast<uint32>(KeyHashes.Num()) <= KeyIndexBuckets * 2)
 	{
-		Keys.Add(Entry.Key);
+		return;
 	}
-	return Keys;
+
+	BuildKeyIndex(KeyHashes.Num());
 }
 
-void UNeoReplicatedDataComponent::NotifyKeyAdded(const FRecordKey& Key, const FRecordDefinition& Value) const
+void FNeoDataMap::BuildKeyIndex(int32 Capacity) const
 {
-	OnKeyAdded.Broadcast(Key, Value);
+	Capacity = FMath::Max(Capacity, KeyHashes.Num());
+	KeyIndexBuckets = FMath::RoundUpToPowerOfTwo(FMath::Max(Capacity, 16));
+	KeyIndex.Clear(KeyIndexBuckets, Capacity);
+	for (int32 Index = 0; Index < KeyHashes.Num(); ++Index)
+	{
+		KeyIndex.Add(KeyHashes[Index], Index);
+	}
+	bKeyIndexValid = true;
 }
 
-void UNeoReplicatedDataComponent::NotifyKeyUpdated(const FRecordKey& Key, const FRecordDefinition& Value) const
+int32 FNeoDataMap::IndexOfKey(const FRecordKey& Key) const
 {
-	OnKeyUpdated.Broadcast(Key, Value);
+	RefreshKeyHashes();
+
+	const uint32 KeyHash = GetTypeHash(Key);
+	if (KeyHashes.Num() >= GNeoDataHashIndexThreshold)
+	{
+		RefreshKeyIndex();
+		return IndexOfKeyIndexed(Key, KeyHash);
+	}
+	return IndexOfKeyScan(Key, KeyHash);
 }
 
-void UNeoReplicatedDataComponent::NotifyKeyRemoved(const FRecordKey& Key) const
+int32 FNeoDataMap::AllocateHandleSlot(const FRecordKey& Key) const
+{
+	const int32 HandleSlot = FreeHandleSlots.Num() > 0 ? FreeHandleSlots.Pop(false) : HandleSlots.AddDefaulted();
+	HandleSlots[HandleSlot].Key = Key;
+	return HandleSlot;
+}
+
+FNeoDataHandle FNeoDataMap::GetHandle(int32 Index) const
+{
+	const FNeoDataEntry& Entry = Items[Index];
+	if (Entry.HandleSlot == INDEX_NONE)
+	{
+		Entry.HandleSlot = AllocateHandleSlot(Entry.Key);
+	}
+
+	FNeoDataHandleSlot& Slot = HandleSlots[Entry.HandleSlot];
+	Slot.ItemIndex = Index;
+	return FNeoDataHandle(Entry.HandleSlot, Slot.Generation);
+}
+
+FNeoDataHandle FNeoDataMap::FindHandle(const FRecordKey& Key) const
 {
-	OnKeyRemoved.Broadcast(Key);
+	FNeoDataTransactionShadow* Shadow = TransactionShadows.IsEmpty() ? nullptr : TransactionShadows.Find(Key);
+	if (Shadow && Shadow->TransactionId != 0)
+	{
+		if (!Shadow->Value)
+		{
+			return FNeoDataHandle();
+		}
+		if (Shadow->bRemoved)
+		{
+			if (Shadow->HandleSlot == INDEX_NONE)
+			{
+				Shadow->HandleSlot = AllocateHandleSlot(Key);
+			}
+			return FNeoDataHandle(Shadow->HandleSlot, HandleSlots[Shadow->HandleSlot].Generation);
+		}
+	}
+
+	const int32 Index = IndexOfKey(Key);
+	return Index != INDEX_NONE ? GetHandle(Index) : FNeoDataHandle();
+}
+
+int32 FNeoDataMap::IndexOfHandle(const FNeoDataHandle& Handle) const
+{
+	if (!HandleSlots.IsValidIndex(Handle.Slot))
+	{
+		return INDEX_NONE;
+	}
+
+	FNeoDataHandleSlot& Slot = HandleSlots[Handle.Slot];
+	if (Slot.Generation != Handle.Generation || Slot.ItemIndex == INDEX_NONE)
+	{
+		return INDEX_NONE;
+	}
+
+	if (Items.IsValidIndex(Slot.ItemIndex) && Items[Slot.ItemIndex].HandleSlot == Handle.Slot)
+	{
+		return Slot.ItemIndex;
+	}
+
+	// Replication swapped entries around since the slot was last resolved
+	const int32 Index = IndexOfKey(Slot.Key);
+	if (Index == INDEX_NONE || Items[Index].HandleSlot != Handle.Slot)
+	{
+		return INDEX_NONE;
+	}
+	Slot.ItemIndex = Index;
+	return Index;
+}
+
+const FRecordDefinition* FNeoDataMap::Find(const FNeoDataHandle& Handle) const
+{
+	const int32 Index = IndexOfHandle(Handle);
+	if (Index != INDEX_NONE)
+	{
+		const FNeoDataEntry& Entry = Items[Index];
+		const FNeoDataTransactionShadow* Shadow = FindTransactionShadow(Entry.Key);
+		return Shadow ? Shadow->Value.GetPtrOrNull() : &Entry.Value;
+	}
+
+	// The entry is gone, but a transaction holding its removal back still serves the handle
+	if (!TransactionShadows.IsEmpty() && HandleSlots.IsValidIndex(Handle.Slot) && HandleSlots[Handle.Slot].Generation == Handle.Generation)
+	{
+		const FNeoDataTransactionShadow* Shadow = FindTransactionShadow(HandleSlots[Handle.Slot].Key);
+		if (Shadow && Shadow->HandleSlot == Handle.Slot)
+		{
+			return Shadow->Value.GetPtrOrNull();
+		}
+	}
+	return nullptr;
+}
+
+void FNeoDataMap::ReleaseHandle(const FNeoDataEntry& Entry) const
+{
+	ReleaseHandleSlot(DetachHandle(Entry));
+}
+
+int32 FNeoDataMap::DetachHandle(const FNeoDataEntry& Entry) const
+{
+	const int32 HandleSlot = Entry.HandleSlot;
+	if (HandleSlot != INDEX_NONE)
+	{
+		HandleSlots[HandleSlot].ItemIndex = INDEX_NONE;
+		Entry.HandleSlot = INDEX_NONE;
+	}
+	return HandleSlot;
+}
+
+void FNeoDataMap::AttachHandle(int32 Index, int32 HandleSlot) const
+{
+	if (HandleSlot == INDEX_NONE)
+	{
+		return;
+	}
+
+	const FNeoDataEntry& Entry = Items[Index];
+	if (Entry.HandleSlot != INDEX_NONE)
+	{
+		ReleaseHandleSlot(HandleSlot);
+		return;
+	}
+
+	Entry.HandleSlot = HandleSlot;
+	HandleSlots[HandleSlot].ItemIndex = Index;
+}
+
+void FNeoDataMap::ReleaseHandleSlot(int32 HandleSlot) const
+{
+	if (HandleSlot == INDEX_NONE)
+	{
+		return;
+	}
+
+	FNeoDataHandleSlot& Slot = HandleSlots[HandleSlot];
+	Slot.Key = FRecordKey();
+	Slot.ItemIndex = INDEX_NONE;
+	++Slot.Generation;
+	FreeHandleSlots.Add(HandleSlot);
+}
+
+void FNeoDataMap::UpdateDigest(const FNeoDataEntry& Entry) const
+{
+	// Defaults are identical everywhere by construction; only what replicates can diverge
+	if (!Digest || Entry.HasFlags(ENeoDataEntryFlags::Default))
+	{
+		return;
+	}
+
+	// The key never changes while the entry is counted, so its hash is computed once
+	if (Entry.DigestValue == 0)
+	{
+		Entry.DigestKeyHash = FNeoDataDigest::HashKey(Entry.Key);
+	}
+
+	const uint64 NewValue = FNeoDataDigest::HashEntry(Entry.DigestKeyHash, Entry.Version, Entry.HasFlags(ENeoDataEntryFlags::Volatile));
+	if (NewValue != Entry.DigestValue)
+	{
+		// Wrapping subtraction: the delta replaces the old contribution with the new one on every node above the leaf
+		Digest->Apply(Digest->GetBucket(Entry.DigestKeyHash), NewValue - Entry.DigestValue);
+		Entry.DigestValue = NewValue;
+	}
+}
+
+void FNeoDataMap::RemoveDigest(const FNeoDataEntry& Entry) const
+{
+	if (Digest && Entry.DigestValue != 0)
+	{
+		Digest->Apply(Digest->GetBucket(Entry.DigestKeyHash), 0 - Entry.DigestValue);
+		Entry.DigestValue = 0;
+	}
+}
+
+void FNeoDataMap::RebuildDigest() const
+{
+	if (!Digest)
+	{
+		return;
+	}
+
+	Digest->Reset();
+	for (const FNeoDataEntry& Entry : Items)
+	{
+		Entry.DigestValue = 0;
+		UpdateDigest(Entry);
+	}
+}
+
+int32 FNeoDataMap::IndexOfStructKey(const UScriptStruct* KeyStruct, const void* KeyMemory) const
+{
+	check(KeyStruct && KeyMemory);
+	RefreshKeyHashes();
+
+	// Same hash and equality GetTypeHash/operator== use for Struct keys, applied to the raw memory
+	const FNeoStructTraits& Traits = FNeoStructTraits::Get(KeyStruct);
+	const uint32 KeyHash = Traits.Hash(KeyMemory);
+	auto Matches = [this, &Traits, KeyStruct, KeyMemory](int32 Index)
+	{
+		const FRecordKey& Candidate = Items[Index].Key;
+		return Candidate.Kind == ENeoRecordKeyKind::Struct && Candidate.KeyData.GetScriptStruct() == KeyStruct
+			&& Traits.Identical(Candidate.KeyData.GetMemory(), KeyMemory);
+	};
+
+	if (KeyHashes.Num() >= GNeoDataHashIndexThreshold)
+	{
+		RefreshKeyIndex();
+		for (uint32 Index = KeyIndex.First(KeyHash); KeyIndex.IsValid(Index); Index = KeyIndex.Next(Index))
+		{
+			if (KeyHashes[Index] == KeyHash && Matches(static_cast<int32>(Index)))
+			{
+				return static_cast<int32>(Index);
+			}
+		}
+		return INDEX_NONE;
+	}
+	return NeoDataKeyScan::FindHash(KeyHashes.GetData(), KeyHashes.Num(), KeyHash, Matches);
+}
+
+int32 FNeoDataMap::IndexOfKeyEntry(const FRecordKey& Key, bool bDefaultEntry) const
+{
+	RefreshKeyHashes();
+
+	const uint32 KeyHash = GetTypeHash(Key);
+	auto Matches = [this, &Key, bDefaultEntry](int32 Index)
+	{
+		return Items[Index].HasFlags(ENeoDataEntryFlags::Default) == bDefaultEntry && Items[Index].Key == Key;
+	};
+
+	if (KeyHashes.Num() >= GNeoDataHashIndexThreshold)
+	{
+		RefreshKeyIndex();
+		for (uint32 Index = KeyIndex.First(KeyHash); KeyIndex.IsValid(Index); Index = KeyIndex.Next(Index))
+		{
+			if (KeyHashes[Index] == KeyHash && Matches(Index))
+			{
+				return static_cast<int32>(Index);
+			}
+		}
+		return INDEX_NONE;
+	}
+	return NeoDataKeyScan::FindHash(KeyHashes.GetData(), KeyHashes.Num(), KeyHash, Matches);
+}
+
+int32 FNeoDataMap::AddDefaultEntry(const FRecordKey& Key, const FRecordDefinition& Value)
+{
+	LLM_SCOPE_BYTAG(NeoDataSync);
+
+	RefreshKeyHashes();
+
+	FNeoDataEntry& NewEntry = Items.Add_GetRef(FNeoDataEntry(Key, Value));
+	NewEntry.SetFlags(ENeoDataEntryFlags::Default, true);
+
+	// Present, so CompareAndSet against version 0 fails like for any other entry
+	NewEntry.Version = ++LastVersion;
+
+	// Local ids below INDEX_NONE never collide with the server's, so the fast array keeps its item map instead of
+	// rebuilding it on every receive for entries it cannot place
+	NewEntry.ReplicationID = --LastLocalID;
+
+	const uint32 KeyHash = GetTypeHash(Key);
+	const int32 NewIndex = KeyHashes.Add(KeyHash);
+	if (bKeyIndexValid)
+	{
+		KeyIndex.Add(KeyHash, NewIndex);
+	}
+	return NewIndex;
+}
+
+bool FNeoDataMap::RemoveDefaultEntry(const FRecordKey& Key, int32* OutHandleSlot)
+{
+	const int32 Index = IndexOfKeyEntry(Key, true);
+	if (Index == INDEX_NONE)
+	{
+		return false;
+	}
+
+	if (OutHandleSlot)
+	{
+		*OutHandleSlot = DetachHandle(Items[Index]);
+	}
+	RemoveAtIndex(Index);
+
+	// Entries moved under the fast array's id -> index map
+	MarkArrayDirty();
+	return true;
+}
+
+void FNeoDataMap::SupersedeTransaction(const FNeoDataEntry& Entry) const
+{
+	if (Owner && Entry.TransactionId != 0 && Entry.TransactionId != ActiveTransactionId && !Entry.Key.IsTransaction())
+	{
+		Owner->SupersedeTransactionWrite(Entry.TransactionId, Entry.Key);
+	}
+}
+
+void FNeoDataMap::RevertToDefault(int32 Index, const FRecordDefinition& DefaultValue)
+{
+	SupersedeTransaction(Items[Index]);
+
+	// Clients with a cached copy must learn the override is gone, as for a removal
+	FNeoDataEntry& Entry = Items[Index];
+	if (Reconnect)
+	{
+		Reconnect->AddTombstone(Entry.Key, ++LastVersion);
+	}
+
+	// Converted in place, so the slot and its handles stay. Connections still list the old replication id and
+	// delete the override from their fast arrays, then reconcile the key to their own default.
+	RemoveDigest(Entry);
+	Entry.Value = DefaultValue;
+	Entry.SetFlags(ENeoDataEntryFlags::Volatile | ENeoDataEntryFlags::Static, false);
+	Entry.SetFlags(ENeoDataEntryFlags::Default, true);
+	Entry.StaticHash = 0;
+	Entry.ExpireTime = 0.0;
+	Entry.TransactionId = 0;
+	Entry.Version = ++LastVersion;
+	Entry.ReplicationID = --LastLocalID;
+	MarkArrayDirty();
+
+	if (Owner)
+	{
+		Owner->NotifyKeyUpdated(Entry.Key, Entry.Value, ActiveTransactionId);
+	}
+
+	++Stats.DefaultReverts;
+	++Stats.AppliedWrites;
+}
+
+int32 FNeoDataMap::IndexOfKeyScan(const FRecordKey& Key, uint32 KeyHash) const
+{
+	// Hash pre-check rejects almost every candidate before the full compare
+	return NeoDataKeyScan::FindHash(KeyHashes.GetData(), KeyHashes.Num(), KeyHash, [this, &Key](int32 Index)
+	{
+		return Items[Index].Key == Key;
+	});
+}
+
+int32 FNeoDataMap::IndexOfKeyIndexed(const FRecordKey& Key, uint32 KeyHash) const
+{
+	for (uint32 Index = KeyIndex.First(KeyHash); KeyIndex.IsValid(Index); Index = KeyIndex.Next(Index))
+	{
+		if (KeyHashes[Index] == KeyHash && Items[Index].Key == Key)
+		{
+			return static_cast<int32>(Index);
+		}
+	}
+	return INDEX_NONE;
+}
+
+bool FNeoDataMap::AddOrUpdate(const FRecordKey& Key, const FRecordDefinition& Value, bool bVolatile, FNeoDataHandle* OutHandle)
+{
+	LLM_SCOPE_BYTAG(NeoDataSync);
+
+	const int32 ExistingIndex = IndexOfKey(Key);
+
+	if (ExistingIndex != INDEX_NONE)
+	{
+		if (OutHandle)
+		{
+			*OutHandle = GetHandle(ExistingIndex);
+		}
+		return UpdateAtIndex(ExistingIndex, Value.Payload.GetScriptStruct(), Value.Payload.GetMemory(), bVolatile);
+	}
+
+	// Add
+	FNeoDataEntry& NewEntry = Items.Add_GetRef(FNeoDataEntry(Key, Value));
+	NewEntry.SetFlags(ENeoDataEntryFlags::Volatile, bVolatile);
+	NewEntry.TransactionId = ActiveTransactionId;
+	NewEntry.Version = ++LastVersion;
+	UpdateDigest(NewEntry);
+	const uint32 KeyHash = GetTypeHash(Key);
+	const int32 NewIndex = KeyHashes.Add(KeyHash);
+	if (bKeyIndexValid)
+	{
+		KeyIndex.Add(KeyHash, NewIndex);
+	}
+	MarkItemDirty(NewEntry);
+
+	// Listeners below may move entries around
+	if (OutHandle)
+	{
+		*OutHandle = GetHandle(NewIndex);
+	}
+
+	if (Owner)
+	{
+		Owner->SupersedeTransactionRemoval(Key);
+	}
+
+	if (Defaults && Owner && Defaults->Contains(Key))
+	{
+		Owner->HandleDefaultKeyChanged(Key, false);
+	}
+
+	// Notify Local
+	if (Owner)
+	{
+		Owner->NotifyKeyAdded(Key, Value, ActiveTransactionId);
+	}
+
+	++Stats.AppliedWrites;
+	return true;
+}
+
+bool FNeoDataMap::UpdateAtIndex(int32 Index, const UScriptStruct* ValueStruct, const void* ValueMemory, bool bVolatile)
+{
+	LLM_SCOPE_BYTAG(NeoDataSync);
+
+	FNeoDataEntry& ExistingEntry = Items[Index];
+	FInstancedStruct& Payload = ExistingEntry.Value.Payload;
+	const bool bVolatileChanged = ExistingEntry.HasFlags(ENeoDataEntryFlags::Volatile) != bVolatile;
+	const bool bSameType = Payload.GetScriptStruct() == ValueStruct;
+
+	// Skip no-op writes, compared with the struct's Identical (native, memcmp or per-property)
+	const bool bSuppressIdentical = !Owner || Owner->bSuppressIdenticalWrites;
+	if (bSuppressIdentical && !bVolatileChanged && bSameType
+		&& (!ValueStruct || FNeoStructTraits::Get(ValueStruct).Identical(Payload.GetMemory(), ValueMemory)))
+	{
+		++Stats.SuppressedWrites;
+		INC_DWORD_STAT(STAT_NeoData_SuppressedWrites);
+		return false;
+	}
+
+	// Back to the baked default: the key is held locally again and its override is deleted from clients.
+	// Not inside a transaction, whose clients wait for every write it made to arrive.
+	if (Defaults && !bVolatile && ActiveTransactionId == 0 && !ExistingEntry.HasFlags(ENeoDataEntryFlags::Default))
+	{
+		const FRecordDefinition* DefaultValue = Defaults->Find(ExistingEntry.Key);
+		if (DefaultValue && DefaultValue->Payload.GetScriptStruct() == ValueStruct
+			&& (!ValueStruct || FNeoStructTraits::Get(ValueStruct).Identical(DefaultValue->Payload.GetMemory(), ValueMemory)))
+		{
+			RevertToDefault(Index, *DefaultValue);
+			return true;
+		}
+	}
+
+	// Update; a value of the same type is copied into the existing allocation
+	if (bSameType && ValueStruct)
+	{
+		ValueStruct->CopyScriptStruct(Payload.GetMutableMemory(), ValueMemory);
+	}
+	else
+	{
+		Payload.InitializeAs(ValueStruct, static_cast<const uint8*>(ValueMemory));
+	}
+	ExistingEntry.SetFlags(ENeoDataEntryFlags::Volatile, bVolatile);
+	ExistingEntry.SetFlags(ENeoDataEntryFlags::Static, false);
+	if (ExistingEntry.HasFlags(ENeoDataEntryFlags::Default))
+	{
+		// Replicates from now on, under a server id
+		ExistingEntry.SetFlags(ENeoDataEntryFlags::Default, false);
+		ExistingEntry.ReplicationID = INDEX_NONE;
+		++Stats.DefaultOverrides;
+	}
+	ExistingEntry.Version = ++LastVersion;
+	UpdateDigest(ExistingEntry);
+
+	if (bVolatile)
+	{
+		++ExistingEntry.VolatileSequence;
+		++Stats.VolatileWrites;
+	}
+
+	// Volatile values go out through the owner's unreliable channel; only the flag change needs the fast array
+	if (!bVolatile || bVolatileChanged)
+	{
+		SupersedeTransaction(ExistingEntry);
+		ExistingEntry.TransactionId = ActiveTransactionId;
+		MarkItemDirty(ExistingEntry);
+	}
+
+	// Notify Local
+	if (Owner)
+	{
+		Owner->NotifyKeyUpdated(ExistingEntry.Key, ExistingEntry.Value, ActiveTransactionId);
+	}
+
+	++Stats.AppliedWrites;
+	return true;
+}
+
+int32 FNeoDataMap::BulkLoad(TArray<TPair<FRecordKey, FRecordDefinition>>&& Entries, TArray<int32>* OutAdded, TArray<int32>* OutUpdated)
+{
+	SCOPE_CYCLE_COUNTER(STAT_NeoData_BulkLoad);
+	LLM_SCOPE_BYTAG(NeoDataSync);
+
+	if (Entries.IsEmpty())
+	{
+		return 0;
+	}
+
+	RefreshKeyHashes();
+
+	// Grow storage once, and size the index for the final count so it is built once instead of per doubling
+	const int32 MaxNum = Items.Num() + Entries.Num();
+	Items.Reserve(MaxNum);
+	KeyHashes.Reserve(MaxNum);
+
+	const bool bUseIndex = MaxNum >= GNeoDataHashIndexThreshold;
+	if (bUseIndex && (!bKeyIndexValid || static_cast<uint32>(MaxNum) > KeyIndexBuckets * 2))
+	{
+		BuildKeyIndex(MaxNum);
+	}
+
+	const bool bSuppressIdentical = !Owner || Owner->bSuppressIdenticalWrites;
+	int32 NumApplied = 0;
+
+	// Entries at or past FirstNewIndex were added by this load; a later duplicate of their key is still an add
+	const int32 FirstNewIndex = Items.Num();
+	TBitArray<> Updated;
+	if (OutUpdated)
+	{
+		Updated.Init(false, FirstNewIndex);
+	}
+
+	for (TPair<FRecordKey, FRecordDefinition>& Pair : Entries)
+	{
+		const uint32 KeyHash = GetTypeHash(Pair.Key);
+		const int32 ExistingIndex = bKeyIndexValid ? IndexOfKeyIndexed(Pair.Key, KeyHash) : IndexOfKeyScan(Pair.Key, KeyHash);
+
+		FNeoDataEntry* Entry = nullptr;
+		if (ExistingIndex != INDEX_NONE)
+		{
+			Entry = &Items[ExistingIndex];
+			if (bSuppressIdentical && !Entry->HasFlags(ENeoDataEntryFlags::Volatile) && Entry->Value.Payload == Pair.Value.Payload)
+			{
+				++Stats.SuppressedWrites;
+				continue;
+			}
+			Entry->Value = MoveTemp(Pair.Value);
+			Entry->SetFlags(ENeoDataEntryFlags::Volatile | ENeoDataEntryFlags::Static, false);
+			if (OutUpdated && ExistingIndex < FirstNewIndex && !Updated[ExistingIndex])
+			{
+				Updated[ExistingIndex] = true;
+				OutUpdated->Add(ExistingIndex);
+			}
+			if (Entry->HasFlags(ENeoDataEntryFlags::Default))
+			{
+				Entry->SetFlags(ENeoDataEntryFlags::Default, false);
+				Entry->ReplicationID = INDEX_NONE;
+				++Stats.DefaultOverrides;
+			}
+		}
+		else
+		{
+			const int32 NewIndex = Items.Num();
+			Entry = &Items.AddDefaulted_GetRef();
+			Entry->Key = MoveTemp(Pair.Key);
+			Entry->Value = MoveTemp(Pair.Value);
+			KeyHashes.Add(KeyHash);
+			// An index built before this load (below the threshold) must stay complete too
+			if (bKeyIndexValid)
+			{
+				KeyIndex.Add(KeyHash, NewIndex);
+			}
+			if (OutAdded)
+			{
+				OutAdded->Add(NewIndex);
+			}
+			if (Owner)
+			{
+				Owner->SupersedeTransactionRemoval(Entry->Key);
+			}
+			if (Defaults && Owner && Defaults->Contains(Entry->Key))
+			{
+				Owner->HandleDefaultKeyChanged(Entry->Key, false);
+			}
+		}
+
+		Entry->Version = ++LastVersion;
+		SupersedeTransaction(*Entry);
+		Entry->TransactionId = 0;
+		UpdateDigest(*Entry);
+
+		// MarkItemDirty without its per-item MarkArrayDirty
+		if (Entry->ReplicationID == INDEX_NONE)
+		{
+			Entry->ReplicationID = ++IDCounter;
+			if (IDCounter == INDEX_NONE)
+			{
+				++IDCounter;
+			}
+		}
+		++Entry->ReplicationKey;
+		++NumApplied;
+	}
+
+	if (NumApplied > 0)
+	{
+		Stats.AppliedWrites += NumApplied;
+		MarkArrayDirty();
+	}
+	return NumApplied;
+}
+
+void FNeoDataMap::Remove(const FRecordKey& Key)
+{
+	const int32 Index = IndexOfKey(Key);
+	if (Index != INDEX_NONE)
+	{
+		RemoveAt(Index);
+	}
+}
+
+void FNeoDataMap::RemoveAt(int32 Index)
+{
+	SupersedeTransaction(Items[Index]);
+
+	// Notify Local before removal
+	if (Owner)
+	{
+		Owner->NotifyKeyRemoved(Items[Index].Key);
+
+		if (Defaults && Defaults->Contains(Items[Index].Key))
+		{
+			Owner->HandleDefaultKeyChanged(Items[Index].Key, true);
+		}
+	}
+
+	RemoveAtIndex(Index);
+	MarkArrayDirty();
+	RequestCompactionIfNeeded();
+}
+
+void FNeoDataMap::RemoveBatch(TConstArrayView<FRecordKey> Keys)
+{
+	bool bRemovedAny = false;
+	for (const FRecordKey& Key : Keys)
+	{
+		const int32 Index = IndexOfKey(Key);
+		if (Index == INDEX_NONE)
+		{
+			continue;
+		}
+
+		SupersedeTransaction(Items[Index]);
+
+		if (Owner)
+		{
+			Owner->NotifyKeyRemoved(Key);
+
+			if (Defaults && Defaults->Contains(Key))
+			{
+				Owner->HandleDefaultKeyChanged(Key, true);
+			}
+		}
+
+		RemoveAtIndex(Index);
+		bRemovedAny = true;
+	}
+
+	// One dirty mark: every removal goes out in the same delta
+	if (bRemovedAny)
+	{
+		MarkArrayDirty();
+		RequestCompactionIfNeeded();
+	}
+}
+
+void FNeoDataMap::SetExpireTime(const FRecordKey& Key, double ExpireTime)
+{
+	const int32 Index = IndexOfKey(Key);
+	if (Index != INDEX_NONE && Items[Index].ExpireTime != ExpireTime)
+	{
+		Items[Index].ExpireTime = ExpireTime;
+		MarkItemDirty(Items[Index]);
+	}
+}
+
+void FNeoDataMap::SetStatic(const FRecordKey& Key, uint64 StaticHash)
+{
+	const int32 Index = IndexOfKey(Key);
+	if (Index == INDEX_NONE)
+	{
+		return;
+	}
+
+	FNeoDataEntry& Entry = Items[Index];
+	if (!Entry.HasFlags(ENeoDataEntryFlags::Static) || Entry.StaticHash != StaticHash)
+	{
+		Entry.SetFlags(ENeoDataEntryFlags::Static, true);
+		Entry.StaticHash = StaticHash;
+		MarkItemDirty(Entry);
+	}
+}
+
+void FNeoDataMap::MarkKeyDirty(const FRecordKey& Key)
+{
+	const int32 Index = IndexOfKey(Key);
+	if (Index != INDEX_NONE)
+	{
+		MarkItemDirty(Items[Index]);
+	}
+}
+
+void FNeoDataMap::ApplyVolatileUpdate(const FNeoVolatileUpdate& Update)
+{
+	LLM_SCOPE_BYTAG(NeoDataSync);
+
+	const int32 Index = IndexOfKey(Update.Key);
+	if (Index == INDEX_NONE)
+	{
+		// Unreliable update raced ahead of the reliable add; the add carries a value at least as new
+		return;
+	}
+
+	FNeoDataEntry& Entry = Items[Index];
+
+	// Wrap-safe "is newer": unreliable RPCs can arrive out of order
+	if (static_cast<int32>(Update.Sequence - Entry.VolatileSequence) <= 0)
+	{
+		return;
+	}
+
+	Entry.Value = Update.Value;
+	Entry.VolatileSequence = Update.Sequence;
+	Entry.Version = Update.Version;
+	UpdateDigest(Entry);
+
+	if (Owner)
+	{
+		Owner->NotifyKeyUpdated(Entry.Key, Entry.Value);
+	}
+}
+
+SIZE_T FNeoDataMap::GetAllocatedSize() const
+{
+	FNeoDataMemoryUsage Usage;
+	GetMemoryUsage(Usage);
+	return static_cast<SIZE_T>(Usage.GetTotalBytes());
+}
+
+void FNeoDataMap::GetMemoryUsage(FNeoDataMemoryUsage& OutUsage) const
+{
+	OutUsage.ItemsBytes = Items.GetAllocatedSize();
+	OutUsage.IndexBytes = KeyHashes.GetAllocatedSize() + (KeyIndexBuckets + KeyIndex.GetIndexSize()) * sizeof(uint32)
+		+ HandleSlots.GetAllocatedSize() + FreeHandleSlots.GetAllocatedSize();
+	OutUsage.CacheBytes = SharedPayloads.GetAllocatedSize();
+	for (const TPair<int32, FNeoSharedPayloadBits>& Pair : SharedPayloads)
+	{
+		OutUsage.CacheBytes += Pair.Value.Data.GetAllocatedSize();
+	}
+
+	TMap<const UScriptStruct*, FNeoDataTypeMemory> Types;
+	for (const FNeoDataEntry& Entry : Items)
+	{
+		if (const UScriptStruct* KeyStruct = Entry.Key.KeyData.GetScriptStruct())
+		{
+			FNeoDataTypeMemory& Type = Types.FindOrAdd(KeyStruct);
+			++Type.NumKeys;
+			Type.KeyBytes += FNeoStructTraits::GetAllocatedSize(Entry.Key.KeyData);
+		}
+		if (const UScriptStruct* ValueStruct = Entry.Value.Payload.GetScriptStruct())
+		{
+			FNeoDataTypeMemory& Type = Types.FindOrAdd(ValueStruct);
+			++Type.NumValues;
+			Type.ValueBytes += FNeoStructTraits::GetAllocatedSize(Entry.Value.Payload);
+		}
+	}
+
+	OutUsage.PayloadBytes = 0;
+	OutUsage.Types.Reset(Types.Num());
+	for (TPair<const UScriptStruct*, FNeoDataTypeMemory>& Pair : Types)
+	{
+		Pair.Value.Struct = Pair.Key;
+		OutUsage.PayloadBytes += Pair.Value.KeyBytes + Pair.Value.ValueBytes;
+		OutUsage.Types.Add(Pair.Value);
+	}
+	OutUsage.Types.Sort([](const FNeoDataTypeMemory& A, const FNeoDataTypeMemory& B)
+	{
+		return A.KeyBytes + A.ValueBytes > B.KeyBytes + B.ValueBytes;
+	});
+}
+
+int64 FNeoDataMap::GetStorageAllocatedSize() const
+{
+	// Stale indexes still hold their storage until rebuilt or freed
+	const int64 IndexBytes = KeyIndexBuckets > 0 ? (KeyIndexBuckets + KeyIndex.GetIndexSize()) * static_cast<int64>(sizeof(uint32)) : 0;
+	return Items.GetAllocatedSize() + KeyHashes.GetAllocatedSize() + IndexBytes;
+}
+
+bool FNeoDataMap::NeedsCompaction() const
+{
+	if (GNeoDataCompactLoadFactor <= 0.0f)
+	{
+		return false;
+	}
+
+	const int32 Num = Items.Num();
+	const bool bSparseItems = Num < Items.Max() * GNeoDataCompactLoadFactor;
+
+	// Buckets are sized for the peak; RefreshKeyIndex only ever grows them
+	const uint32 NeededBuckets = FMath::RoundUpToPowerOfTwo(FMath::Max(Num, 16));
+	const bool bSparseIndex = KeyIndexBuckets > 0 && NeededBuckets < KeyIndexBuckets * GNeoDataCompactLoadFactor;
+
+	if (!bSparseItems && !bSparseIndex)
+	{
+		return false;
+	}
+
+	const int64 UsedBytes = Num * static_cast<int64>(sizeof(FNeoDataEntry) + sizeof(uint32))
+		+ (KeyIndexBuckets > 0 ? (NeededBuckets + Num) * static_cast<int64>(sizeof(uint32)) : 0);
+	return GetStorageAllocatedSize() - UsedBytes >= GNeoDataCompactMinSlackBytes;
+}
+
+int64 FNeoDataMap::Compact()
+{
+	LLM_SCOPE_BYTAG(NeoDataSync);
+
+	const int64 BytesBefore = GetStorageAllocatedSize();
+
+	Items.Shrink();
+	RefreshKeyHashes();
+	KeyHashes.Shrink();
+
+	if (KeyIndexBuckets > 0)
+	{
+		if (KeyHashes.Num() >= GNeoDataHashIndexThreshold)
+		{
+			BuildKeyIndex(KeyHashes.Num());
+		}
+		else
+		{
+			// Below the threshold lookups scan; the index is rebuilt if the map grows again
+			KeyIndex.Free();
+			KeyIndexBuckets = 0;
+			bKeyIndexValid = false;
+		}
+	}
+
+	SharedPayloads.Shrink();
+
+	const int64 Reclaimed = FMath::Max<int64>(BytesBefore - GetStorageAllocatedSize(), 0);
+	++Stats.Compactions;
+	Stats.CompactionReclaimedBytes += Reclaimed;
+	INC_DWORD_STAT(STAT_NeoData_Compactions);
+	INC_DWORD_STAT_BY(STAT_NeoData_CompactionReclaimedBytes, Reclaimed);
+	return Reclaimed;
+}
+
+void FNeoDataMap::RequestCompactionIfNeeded()
+{
+	if (Owner && NeedsCompaction())
+	{
+		Owner->RequestCompaction();
+	}
+}
+
+void FNeoDataMap::RemoveAtIndex(int32 Index)
+{
+	// Local defaults are never in a client's cache
+	if (Reconnect && !Items[Index].HasFlags(ENeoDataEntryFlags::Default))
+	{
+		Reconnect->AddTombstone(Items[Index].Key, ++LastVersion);
+	}
+
+	if (bKeyIndexValid)
+	{
+		// The last entry moves into Index
+		const int32 LastIndex = KeyHashes.Num() - 1;
+		KeyIndex.Remove(KeyHashes[Index], Index);
+		if (Index != LastIndex)
+		{
+			KeyIndex.Remove(KeyHashes[LastIndex], LastIndex);
+			KeyIndex.Add(KeyHashes[LastIndex], Index);
+		}
+	}
+
+	ReleaseHandle(Items[Index]);
+	RemoveDigest(Items[Index]);
+	const int32 MovedIndex = Items.Num() - 1;
+	if (Index != MovedIndex && Items[MovedIndex].HandleSlot != INDEX_NONE)
+	{
+		HandleSlots[Items[MovedIndex].HandleSlot].ItemIndex = Index;
+	}
+
+	// Order is not meaningful for a fast array (clients never see server order), so swap instead of shifting
+	Items.RemoveAtSwap(Index, 1, false);
+	KeyHashes.RemoveAtSwap(Index, 1, false);
+}
+
+int32 FNeoDataMap::RestoreEntries(TArray<FNeoDataEntry>&& Entries)
+{
+	LLM_SCOPE_BYTAG(NeoDataSync);
+
+	Items.Reserve(Items.Num() + Entries.Num());
+
+	int32 NumRestored = 0;
+	for (FNeoDataEntry& Entry : Entries)
+	{
+		// A fresh copy may have arrived from the server already; a local default gives way to the cached override,
+		// which carries on its handles
+		int32 HandleSlot = INDEX_NONE;
+		if (IndexOfKey(Entry.Key) != INDEX_NONE && !RemoveDefaultEntry(Entry.Key, &HandleSlot))
+		{
+			continue;
+		}
+
+		Entry.HandleSlot = INDEX_NONE;
+		Entry.DigestValue = 0;
+
+		const int32 NewIndex = Items.Add(MoveTemp(Entry));
+		KeyHashes.Add(GetTypeHash(Items[NewIndex].Key));
+		if (bKeyIndexValid)
+		{
+			KeyIndex.Add(KeyHashes[NewIndex], NewIndex);
+		}
+		UpdateDigest(Items[NewIndex]);
+		AttachHandle(NewIndex, HandleSlot);
+		++NumRestored;
+	}
+	return NumRestored;
+}
+
+const FRecordDefinition* FNeoDataMap::Find(const FRecordKey& Key) const
+{
+	if (const FNeoDataTransactionShadow* Shadow = FindTransactionShadow(Key))
+	{
+		return Shadow->Value.GetPtrOrNull();
+	}
+
+	const int32 Index = IndexOfKey(Key);
+	return Index != INDEX_NONE ? &Items[Index].Value : nullptr;
+}
+
+FRecordDefinition* FNeoDataMap::Find(const FRecordKey& Key)
+{
+	const int32 Index = IndexOfKey(Key);
+	return Index != INDEX_NONE ? &Items[Index].Value : nullptr;
+}
+
+void FNeoDataMap::GetKeys(TArray<FRecordKey>& OutKeys) const
+{
+	const bool bShadowed = HasTransactionShadows();
+
+	OutKeys.Reserve(OutKeys.Num() + Items.Num());
+	for (const FNeoDataEntry& Entry : Items)
+	{
+		if (Entry.Key.IsTransaction())
+		{
+			continue;
+		}
+		const FNeoDataTransactionShadow* Shadow = bShadowed ? FindTransactionShadow(Entry.Key) : nullptr;
+		if (!Shadow || Shadow->Value)
+		{
+			OutKeys.Add(Entry.Key);
+		}
+	}
+
+	if (bShadowed)
+	{
+		for (const TPair<FRecordKey, FNeoDataTransactionShadow>& Pair : TransactionShadows)
+		{
+			if (Pair.Value.bRemoved && Pair.Value.TransactionId != 0 && Pair.Value.Value)
+			{
+				OutKeys.Add(Pair.Key);
+			}
+		}
+	}
+}
+
+const FNeoDataTransactionShadow* FNeoDataMap::FindTransactionShadow(const FRecordKey& Key) const
+{
+	if (TransactionShadows.IsEmpty())
+	{
+		return nullptr;
+	}
+
+	// Removals of the current receive not matched to a transaction read as removed
+	const FNeoDataTransactionShadow* Shadow = TransactionShadows.Find(Key);
+	return Shadow && Shadow->TransactionId != 0 ? Shadow : nullptr;
+}
+
+void FNeoDataMap::ShadowReceivedEntry(const FNeoDataEntry& Entry, int64 PreviousVersion) const
+{
+	if (FNeoDataTransactionShadow* Shadow = TransactionShadows.IsEmpty() ? nullptr : TransactionShadows.Find(Entry.Key))
+	{
+		// Taken over by a later transaction (the server dropped it from the earlier one): readers keep the value
+		// from before both. An untransacted write makes the key current again.
+		if (Entry.TransactionId != 0)
+		{
+			Shadow->TransactionId = Entry.TransactionId;
+			return;
+		}
+		ReleaseHandleSlot(Shadow->HandleSlot);
+		TransactionShadows.Remove(Entry.Key);
+		return;
+	}
+
+	if (Entry.TransactionId == 0)
+	{
+		return;
+	}
+
+	FNeoDataTransactionShadow& Shadow = TransactionShadows.Add(Entry.Key);
+	Shadow.TransactionId = Entry.TransactionId;
+	if (PreviousVersion != 0)
+	{
+		Shadow.Value = Entry.Value;
+		Shadow.Version = PreviousVersion;
+	}
+	else if (const FRecordDefinition* DefaultValue = Defaults ? Defaults->Find(Entry.Key) : nullptr)
+	{
+		// A new override of a baked default
+		if (!Owner || !Owner->IsDefaultRemoved(Entry.Key))
+		{
+			Shadow.Value = *DefaultValue;
+		}
+	}
+}
+
+void FNeoDataMap::ShadowRemovedEntry(const FNeoDataEntry& Entry) const
+{
+	FNeoDataTransactionShadow& Shadow = TransactionShadows.FindOrAdd(Entry.Key);
+	if (!Shadow.bRemoved && Shadow.TransactionId == 0)
+	{
+		Shadow.Value = Entry.Value;
+		Shadow.Version = Entry.Version;
+	}
+	Shadow.bRemoved = true;
+	if (Shadow.HandleSlot == INDEX_NONE)
+	{
+		Shadow.HandleSlot = DetachHandle(Entry);
+	}
+}
+
+void FNeoDataMap::AssignTransactionShadow(const FRecordKey& Key, int32 TransactionId) const
+{
+	if (FNeoDataTransactionShadow* Shadow = TransactionShadows.IsEmpty() ? nullptr : TransactionShadows.Find(Key))
+	{
+		Shadow->TransactionId = TransactionId;
+	}
+}
+
+void FNeoDataMap::ReleaseTransactionShadows(TFunctionRef<bool(int32)> IsPending) const
+{
+	for (auto It = TransactionShadows.CreateIterator(); It; ++It)
+	{
+		if (It->Value.TransactionId == 0 || !IsPending(It->Value.TransactionId))
+		{
+			ReleaseHandleSlot(It->Value.HandleSlot);
+			It.RemoveCurrent();
+		}
+	}
+}
+
+void FNeoDataMap::PostReplicatedReceive(const FFastArraySerializer::FPostReplicatedReceiveParameters& Parameters)
+{
+	// Removed items are compacted out after the per-item callbacks
+	InvalidateKeyCache();
+	RequestCompactionIfNeeded();
+
+	if (Owner)
+	{
+		if (PendingDefaultKeys.Num() > 0)
+		{
+			const TArray<TPair<FRecordKey, bool>> DefaultKeys = MoveTemp(PendingDefaultKeys);
+			PendingDefaultKeys.Reset();
+			Owner->ReconcileDefaults(DefaultKeys);
+		}
+		Owner->FlushStaticRequests();
+	}
+}
+
+// ------------------------------------------------------------------------------------------------
+// UNeoReplicatedDataComponent
+// ------------------------------------------------------------------------------------------------
+
+namespace NeoReplicatedData
+{
+	/** Struct type a key is checked against for RestrictedKeyType. Name and Int keys have none. */
+	static const UScriptStruct* GetKeyStruct(const FRecordKey& Key)
+	{
+		switch (Key.Kind)
+		{
+		case ENeoRecordKeyKind::Guid:			return TBaseStructure<FGuid>::Get();
+		case ENeoRecordKeyKind::GameplayTag:	return FGameplayTag::StaticStruct();
+		case ENeoRecordKeyKind::Struct:			return Key.KeyData.GetScriptStruct();
+		default:								return nullptr;
+		}
+	}
+
+	/**
+	 * A key handed over as property memory by the typed Blueprint API. Inline kinds and RecordKeys resolve to Key;
+	 * other structs stay as Struct/Memory and are looked up in place, so no instanced struct is built for them.
+	 */
+	struct FKeyRef
+	{
+		FRecordKey Inline;
+		const FRecordKey* Key = nullptr;
+		const UScriptStruct* Struct = nullptr;
+		const void* Memory = nullptr;
+
+		const UScriptStruct* GetKeyStruct() const { return Key ? NeoReplicatedData::GetKeyStruct(*Key) : Struct; }
+		ENeoRecordKeyKind GetKind() const { return Key ? Key->Kind : ENeoRecordKeyKind::Struct; }
+
+		int32 IndexIn(const FNeoDataMap& Map) const
+		{
+			return Key ? Map.IndexOfKey(*Key) : Map.IndexOfStructKey(Struct, Memory);
+		}
+
+		/** The key as stored in a new entry; only Struct keys allocate. */
+		FRecordKey ToRecordKey() const
+		{
+			if (Key)
+			{
+				return *Key;
+			}
+
+			FInstancedStruct KeyData;
+			KeyData.InitializeAs(Struct, static_cast<const uint8*>(Memory));
+			return FRecordKey(KeyData);
+		}
+	};
+
+	static bool ResolveStructKey(const UScriptStruct* Struct, const void* Memory, FKeyRef& Out)
+	{
+		if (Struct == FRecordKey::StaticStruct())
+		{
+			Out.Key = &static_cast<const FRecordKey*>(Memory)->Normalize(Out.Inline);
+			return Out.Key->IsValid();
+		}
+		if (Struct == TBaseStructure<FGuid>::Get())
+		{
+			Out.Inline = FRecordKey(*static_cast<const FGuid*>(Memory));
+			Out.Key = &Out.Inline;
+			return true;
+		}
+		if (Struct == FGameplayTag::StaticStruct())
+		{
+			Out.Inline = FRecordKey(*static_cast<const FGameplayTag*>(Memory));
+			Out.Key = &Out.Inline;
+			return true;
+		}
+		if (Struct == FInstancedStruct::StaticStruct())
+		{
+			const FInstancedStruct& Instanced = *static_cast<const FInstancedStruct*>(Memory);
+			return Instanced.IsValid() && ResolveStructKey(Instanced.GetScriptStruct(), Instanced.GetMemory(), Out);
+		}
+
+		Out.Struct = Struct;
+		Out.Memory = Memory;
+		return true;
+	}
+
+	/** Copies a stored payload into caller memory of ValueStruct; false if the payload is not a ValueStruct. */
+	static bool CopyPayloadTo(const FInstancedStruct& Payload, const UScriptStruct* ValueStruct, void* OutValueMemory)
+	{
+		const UScriptStruct* StoredStruct = Payload.GetScriptStruct();
+		if (!StoredStruct || !StoredStruct->IsChildOf(ValueStruct))
+		{
+			return false;
+		}
+
+		ValueStruct->CopyScriptStruct(OutValueMemory, Payload.GetMemory());
+		return true;
+	}
+
+	/** Accepts structs, names, integers and enums, mirroring FRecordKey::Make. */
+	static bool ResolveKey(const FProperty* Property, const void* Memory, FKeyRef& Out)
+	{
+		if (const FStructProperty* StructProperty = CastField<FStructProperty>(Property))
+		{
+			return ResolveStructKey(StructProperty->Struct, Memory, Out);
+		}
+		if (const FNameProperty* NameProperty = CastField<FNameProperty>(Property))
+		{
+			Out.Inline = FRecordKey(NameProperty->GetPropertyValue(Memory));
+			Out.Key = &Out.Inline;
+			return true;
+		}
+
+		const FNumericProperty* NumericProperty = CastField<FNumericProperty>(Property);
+		if (const FEnumProperty* EnumProperty = CastField<FEnumProperty>(Property))
+		{
+			NumericProperty = EnumProperty->GetUnderlyingProperty();
+		}
+		if (NumericProperty && NumericProperty->IsInteger())
+		{
+			Out.Inline = FRecordKey(NumericProperty->GetSignedIntPropertyValue(Memory));
+			Out.Key = &Out.Inline;
+			return true;
+		}
+
+		return false;
+	}
+}
+
+UNeoReplicatedDataComponent::UNeoReplicatedDataComponent()
+{
+	SetIsReplicatedByDefault(true);
+	DataMap.Owner = this;
+
+	// Only ticks while there is deferred work; see UpdateTickEnabled
+	PrimaryComponentTick.bCanEverTick = true;
+	PrimaryComponentTick.bStartWithTickEnabled = false;
+}
+
+UNeoReplicatedDataComponent::~UNeoReplicatedDataComponent() = default;
+
+void UNeoReplicatedDataComponent::OnRegister()
+{
+	const double RegisterStartTime = FPlatformTime::Seconds();
+	if (LoadTiming.RegisterTime == 0.0)
+	{
+		LoadTiming.RegisterTime = RegisterStartTime;
+	}
+
+	Super::OnRegister();
+
+	if (HistoryCapacity <= 0)
+	{
+		History.Reset();
+	}
+	else if (!History || History->GetCapacity() != HistoryCapacity)
+	{
+		History = MakeUnique<FNeoDataHistory>(HistoryCapacity);
+	}
+
+	if (!bEnableStateDigest)
+	{
+		Digest.Reset();
+	}
+	else if (!Digest || Digest->GetNumBuckets() != static_cast<int32>(FMath::RoundUpToPowerOfTwo(FMath::Clamp(DigestBuckets, 16, 65536))))
+	{
+		Digest = MakeUnique<FNeoDataDigest>(DigestBuckets);
+	}
+	DataMap.Digest = Digest.Get();
+	DataMap.RebuildDigest();
+
+	LoadDefaults();
+
+	if (!ReplayScrubCompleteHandle.IsValid())
+	{
+		ReplayScrubCompleteHandle = FNetworkReplayDelegates::OnReplayScrubComplete.AddUObject(this, &UNeoReplicatedDataComponent::HandleReplayScrubComplete);
+	}
+
+	FNeoDataLoadTracker::Get().Record(ENeoDataLoadPhase::Register, FPlatformTime::Seconds() - RegisterStartTime);
+}
+
+void UNeoReplicatedDataComponent::RecordNetDeltaSerialize(bool bReading, double Seconds, int64 Bytes)
+{
+	FNeoDataLoadTracker& Tracker = FNeoDataLoadTracker::Get();
+	const double SinceRegister = LoadTiming.RegisterTime > 0.0 ? FPlatformTime::Seconds() - LoadTiming.RegisterTime : 0.0;
+
+	if (bReading)
+	{
+		LoadTiming.bFirstReceiveRecorded = true;
+		Tracker.Record(ENeoDataLoadPhase::FirstReceive, Seconds, Bytes);
+		Tracker.Record(ENeoDataLoadPhase::TimeToFirstReceive, SinceRegister);
+		return;
+	}
+
+	LoadTiming.bFirstSendRecorded = true;
+	Tracker.Record(ENeoDataLoadPhase::Populate, LoadTiming.PopulateSeconds);
+	Tracker.Record(ENeoDataLoadPhase::FirstSend, Seconds, Bytes);
+	Tracker.Record(ENeoDataLoadPhase::TimeToFirstSend, SinceRegister);
+}
+
+void UNeoReplicatedDataComponent::OnUnregister()
+{
+	FNetworkReplayDelegates::OnReplayScrubComplete.Remove(ReplayScrubCompleteHandle);
+	ReplayScrubCompleteHandle.Reset();
+
+	Super::OnUnregister();
+}
+
+void UNeoReplicatedDataComponent::BeginPlay()
+{
+	Super::BeginPlay();
+
+	if (LoadTiming.RegisterTime > 0.0)
+	{
+		FNeoDataLoadTracker::Get().Record(ENeoDataLoadPhase::TimeToBeginPlay, FPlatformTime::Seconds() - LoadTiming.RegisterTime);
+	}
+
+	// Only the owning client can reach the server; the server holds the map for no other connection
+	const AActor* Actor = GetOwner();
+	if (!bEnableReconnectResync || GetOwnerRole() == ROLE_Authority || !Actor || !Actor->GetNetConnection())
+	{
+		return;
+	}
+
+	FGuid Epoch;
+	int64 Version = 0;
+	const UNeoDataReconnectCache* Cache = UNeoDataReconnectCache::Get(this);
+	const FString CacheId = GetReconnectCacheId();
+	if (const FNeoDataCachedState* Cached = Cache && !CacheId.IsEmpty() ? Cache->Find(CacheId) : nullptr)
+	{
+		Epoch = Cached->Epoch;
+		Version = Cached->Version;
+	}
+	ServerReportCachedState(Epoch, Version);
+}
+
+void UNeoReplicatedDataComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	OnComponentEndPlay.Broadcast();
+
+	// Destroyed means the server removed the actor, so there is nothing to come back to
+	if (bEnableReconnectResync && EndPlayReason != EEndPlayReason::Destroyed && GetOwnerRole() != ROLE_Authority && StateEpoch.IsValid())
+	{
+		UNeoDataReconnectCache* Cache = UNeoDataReconnectCache::Get(this);
+		const FString CacheId = GetReconnectCacheId();
+		if (Cache && !CacheId.IsEmpty())
+		{
+			// The received watermark is contiguous: entries of sends still missing after a lost packet are above it
+			FNeoDataCachedState State;
+			State.Epoch = StateEpoch;
+			State.Version = DataMap.GetReceivedVersion();
+
+			for (const FNeoDataEntry& Entry : DataMap.Items)
+			{
+				// Loaded from DefaultsAsset again on the next connection
+				if (Entry.HasFlags(ENeoDataEntryFlags::Default))
+				{
+					continue;
+				}
+
+				// Object references do not outlive the connection, and unfetched static values are empty; the server re-sends such entries
+				const UScriptStruct* ValueStruct = Entry.Value.Payload.GetScriptStruct();
+				const UScriptStruct* KeyStruct = Entry.Key.KeyData.GetScriptStruct();
+				if (Entry.bAwaitingStatic || (ValueStruct && ValueStruct->RefLink) || (KeyStruct && KeyStruct->RefLink))
+				{
+					State.Version = FMath::Min(State.Version, Entry.Version - 1);
+					continue;
+				}
+
+				State.Items.Add(Entry);
+			}
+
+			Cache->Store(CacheId, MoveTemp(State));
+		}
+	}
+
+	// Persist static values fetched this session; a no-op unless some were added
+	if (GetOwnerRole() != ROLE_Authority)
+	{
+		FNeoDataStaticCache::Get().Save();
+	}
+
+	Super::EndPlay(EndPlayReason);
+}
+
+FString UNeoReplicatedDataComponent::GetReconnectCacheId() const
+{
+	if (!ReconnectCacheId.IsNone())
+	{
+		return ReconnectCacheId.ToString();
+	}
+
+	const AActor* Actor = GetOwner();
+	const APlayerState* PlayerState = Cast<APlayerState>(Actor);
+	if (const APawn* Pawn = Cast<APawn>(Actor))
+	{
+		PlayerState = Pawn->GetPlayerState();
+	}
+	else if (const AController* Controller = Cast<AController>(Actor))
+	{
+		PlayerState = Controller->PlayerState;
+	}
+
+	if (!PlayerState || !PlayerState->GetUniqueId().IsValid())
+	{
+		return FString();
+	}
+	return FString::Printf(TEXT("%s/%s/%s"), *PlayerState->GetUniqueId().ToString(), *Actor->GetClass()->GetName(), *GetName());
+}
+
+void UNeoReplicatedDataComponent::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
+{
+	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
+
+	DOREPLIFETIME(UNeoReplicatedDataComponent, DataMap);
+	DOREPLIFETIME(UNeoReplicatedDataComponent, StateEpoch);
+	DOREPLIFETIME(UNeoReplicatedDataComponent, RemovedDefaults);
+	DOREPLIFETIME_CONDITION(UNeoReplicatedDataComponent, DefaultsHash, COND_InitialOnly);
+}
+
+void UNeoReplicatedDataComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
+{
+	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+
+	FlushVolatileUpdates();
+	SettleVolatileKeys(GetWorld()->GetTimeSeconds());
+	ExpireEntries(GetServerWorldTime());
+	RunPendingCompaction();
+
+	UpdateTickEnabled();
+}
+
+void UNeoReplicatedDataComponent::UpdateTickEnabled()
+{
+	const bool bHasWork = !PendingVolatileKeys.IsEmpty() || !VolatileLastWriteTimes.IsEmpty()
+		|| (ExpiryWheel && ExpiryWheel->Num() > 0) || bCompactionPending;
+	if (bHasWork != IsComponentTickEnabled())
+	{
+		SetComponentTickEnabled(bHasWork);
+	}
+}
+
+void UNeoReplicatedDataComponent::RequestCompaction()
+{
+	if (!bCompactionPending)
+	{
+		bCompactionPending = true;
+		UpdateTickEnabled();
+	}
+}
+
+void UNeoReplicatedDataComponent::RunPendingCompaction()
+{
+	if (!bCompactionPending)
+	{
+		return;
+	}
+
+	// Writes since the request may have refilled the map
+	if (!DataMap.NeedsCompaction())
+	{
+		bCompactionPending = false;
+		return;
+	}
+
+	// One budget shared by every map, so a phase change that empties many maps spreads over several frames
+	static uint64 BudgetFrame = 0;
+	static int64 BudgetUsed = 0;
+	if (BudgetFrame != GFrameCounter)
+	{
+		BudgetFrame = GFrameCounter;
+		BudgetUsed = 0;
+	}
+
+	const int64 Cost = DataMap.GetCompactionCost();
+	if (BudgetUsed > 0 && BudgetUsed + Cost > GNeoDataCompactBudgetBytes)
+	{
+		return;
+	}
+
+	BudgetUsed += Cost;
+	DataMap.Compact();
+	bCompactionPending = false;
+}
+
+int64 UNeoReplicatedDataComponent::CompactStorage()
+{
+	bCompactionPending = false;
+	const int64 Reclaimed = DataMap.Compact();
+	UpdateTickEnabled();
+	return Reclaimed;
+}
+
+double UNeoReplicatedDataComponent::GetServerWorldTime() const
+{
+	const UWorld* World = GetWorld();
+	if (!World)
+	{
+		return 0.0;
+	}
+
+	const AGameStateBase* GameState = World->GetGameState();
+	return GameState ? GameState->GetServerWorldTimeSeconds() : World->GetTimeSeconds();
+}
+
+void UNeoReplicatedDataComponent::ExpireEntries(double Now)
+{
+	if (!ExpiryWheel || ExpiryWheel->Num() == 0)
+	{
+		return;
+	}
+
+	TArray<FNeoExpiryTimer> Due;
+	ExpiryWheel->Advance(Now, Due);
+
+	TArray<FRecordKey> Expired;
+	Expired.Reserve(Due.Num());
+	for (FNeoExpiryTimer& Timer : Due)
+	{
+		// Timers are not cancelled: skip keys removed or re-armed since this one was scheduled
+		const int32 Index = DataMap.IndexOfKey(Timer.Key);
+		if (Index != INDEX_NONE && DataMap.Items[Index].ExpireTime == Timer.ExpireTime)
+		{
+			Expired.Add(MoveTemp(Timer.Key));
+		}
+	}
+
+	DataMap.Stats.ExpiredEntries += Expired.Num();
+	DataMap.RemoveBatch(Expired);
+
+	// Removals of expired manifests can no longer be superseded
+	if (!TransactionRemovals.IsEmpty() && Expired.ContainsByPredicate([](const FRecordKey& Key) { return Key.IsTransaction(); }))
+	{
+		for (auto It = TransactionRemovals.CreateIterator(); It; ++It)
+		{
+			if (DataMap.IndexOfKey(FRecordKey::MakeTransaction(It->Value)) == INDEX_NONE)
+			{
+				It.RemoveCurrent();
+			}
+		}
+	}
+}
+
+void UNeoReplicatedDataComponent::FlushVolatileUpdates()
+{
+	if (PendingVolatileKeys.IsEmpty())
+	{
+		return;
+	}
+
+	// Latest value wins: several writes to one key since the last flush go out as one update
+	TArray<FNeoVolatileUpdate> Batch;
+	Batch.Reserve(FMath::Min(PendingVolatileKeys.Num(), MaxVolatileUpdatesPerBatch));
+
+	for (const FRecordKey& Key : PendingVolatileKeys)
+	{
+		const int32 Index = DataMap.IndexOfKey(Key);
+		if (Index == INDEX_NONE || !DataMap.Items[Index].HasFlags(ENeoDataEntryFlags::Volatile))
+		{
+			continue;
+		}
+
+		const FNeoDataEntry& Entry = DataMap.Items[Index];
+		FNeoVolatileUpdate& Update = Batch.AddDefaulted_GetRef();
+		Update.Key = Entry.Key;
+		Update.Value = Entry.Value;
+		Update.Sequence = Entry.VolatileSequence;
+		Update.Version = Entry.Version;
+
+		if (Batch.Num() >= MaxVolatileUpdatesPerBatch)
+		{
+			DataMap.Stats.VolatileUpdatesSent += Batch.Num();
+			++DataMap.Stats.VolatileBatchesSent;
+			MulticastVolatileUpdates(Batch);
+			Batch.Reset();
+		}
+	}
+
+	if (Batch.Num() > 0)
+	{
+		DataMap.Stats.VolatileUpdatesSent += Batch.Num();
+		++DataMap.Stats.VolatileBatchesSent;
+		MulticastVolatileUpdates(Batch);
+	}
+
+	PendingVolatileKeys.Reset();
+}
+
+void UNeoReplicatedDataComponent::SettleVolatileKeys(double Now)
+{
+	for (auto It = VolatileLastWriteTimes.CreateIterator(); It; ++It)
+	{
+		if (Now - It->Value >= VolatileSettleDelay)
+		{
+			// One reliable re-send so every client converges on the final value
+			DataMap.MarkKeyDirty(It->Key);
+			++DataMap.Stats.VolatileSettles;
+			It.RemoveCurrent();
+		}
+	}
+}
+
+void UNeoReplicatedDataComponent::MulticastVolatileUpdates_Implementation(const TArray<FNeoVolatileUpdate>& Updates)
+{
+	// The authority already holds these values
+	if (GetOwnerRole() == ROLE_Authority)
+	{
+		return;
+	}
+
+	for (const FNeoVolatileUpdate& Update : Updates)
+	{
+		DataMap.ApplyVolatileUpdate(Update);
+	}
+}
+
+bool UNeoReplicatedDataComponent::VerifyStateDigest()
+{
+	if (!Digest || GetOwnerRole() == ROLE_Authority)
+	{
+		return false;
+	}
+
+	// A new check supersedes one still in flight; its late replies only repair more
+	DigestRoundBuckets = 0;
+	++DataMap.Stats.DigestChecks;
+	ServerCompareDigest({ 1 }, { Digest->GetRoot() });
+	return true;
+}
+
+void UNeoReplicatedDataComponent::ServerCompareDigest_Implementation(const TArray<int32>& Nodes, const TArray<uint64>& Hashes)
+{
+	const AActor* Actor = GetOwner();
+	UNetConnection* Connection = Actor ? Actor->GetNetConnection() : nullptr;
+
+	FNeoDataDigestResponse Response;
+	if (!Digest || !Connection || Nodes.Num() != Hashes.Num())
+	{
+		ClientDigestResponse(Response);
+		return;
+	}
+
+	FNeoDataDigestRepair* Repair = DigestRepairs.Find(Connection);
+	if (!Repair)
+	{
+		// Drop the state of connections that have closed
+		for (auto It = DigestRepairs.CreateIterator(); It; ++It)
+		{
+			if (!It->Key.ResolveObjectPtr())
+			{
+				It.RemoveCurrent();
+			}
+		}
+		Repair = &DigestRepairs.Add(Connection);
+	}
+
+	// Each request walks the tree and the divergent buckets' entries: cap them per connection
+	const double Now = GetWorld() ? GetWorld()->GetRealTimeSeconds() : 0.0;
+	if (Now - Repair->WindowStart >= GNeoDataDigestRequestWindow)
+	{
+		Repair->WindowStart = Now;
+		Repair->Requests = 0;
+	}
+	if (++Repair->Requests > FMath::Max(GNeoDataDigestMaxRequests, 1))
+	{
+		++DataMap.Stats.DigestThrottledRequests;
+
+		// Tell the client once per window so its check completes; ignore the rest
+		if (Repair->Requests == FMath::Max(GNeoDataDigestMaxRequests, 1) + 1)
+		{
+			Response.bThrottled = true;
+			ClientDigestResponse(Response);
+		}
+		return;
+	}
+
+	TBitArray<> Visited(false, Digest->GetNumBuckets() * 2);
+	const int32 NumNodes = FMath::Min(Nodes.Num(), GNeoDataDigestMaxNodes);
+	for (int32 Index = 0; Index < NumNodes; ++Index)
+	{
+		const int32 Node = Nodes[Index];
+		if (!Digest->IsValidNode(Node) || Visited[Node] || Digest->GetNode(Node) == Hashes[Index])
+		{
+			continue;
+		}
+		Visited[Node] = true;
+
+		if (Digest->IsLeaf(Node))
+		{
+			Response.Buckets.Add(Digest->GetLeafBucket(Node));
+		}
+		else if (Response.Nodes.Num() < GNeoDataDigestMaxNodes)
+		{
+			// Subtrees past the cap are left for the next check
+			Digest->GetDescendants(Node, FMath::Max(1, GNeoDataDigestDrillDepth), Response.Nodes);
+		}
+	}
+
+	Response.Hashes.Reserve(Response.Nodes.Num());
+	for (const int32 Node : Response.Nodes)
+	{
+		Response.Hashes.Add(Digest->GetNode(Node));
+	}
+
+	if (Response.Buckets.Num() > 0)
+	{
+		TBitArray<> DivergentBuckets(false, Digest->GetNumBuckets());
+		for (const int32 Bucket : Response.Buckets)
+		{
+			DivergentBuckets[Bucket] = true;
+		}
+
+		// Re-send the divergent buckets' entries to this client; the client drops its own entries the server no longer lists
+		for (const FNeoDataEntry& Entry : DataMap.Items)
+		{
+			if (Entry.DigestValue != 0 && DivergentBuckets[Digest->GetBucket(Entry.DigestKeyHash)])
+			{
+				Response.KeyHashes.Add(Entry.DigestKeyHash);
+				if (Entry.ReplicationID != INDEX_NONE)
+				{
+					Repair->ResendIDs.Add(Entry.ReplicationID);
+				}
+				++DataMap.Stats.DigestResentEntries;
+			}
+		}
+
+		if (Repair->ResendIDs.Num() > 0)
+		{
+			GetOwner()->ForceNetUpdate();
+		}
+	}
+
+	ClientDigestResponse(Response);
+}
+
+void UNeoReplicatedDataComponent::ClientDigestResponse_Implementation(const FNeoDataDigestResponse& Response)
+{
+	if (!Digest)
+	{
+		return;
+	}
+
+	if (Response.bThrottled)
+	{
+		OnStateDigestVerified.Broadcast(false, DigestRoundBuckets);
+		return;
+	}
+
+	if (Response.Buckets.Num() > 0)
+	{
+		DigestRoundBuckets += Response.Buckets.Num();
+		DataMap.Stats.DigestDivergentBuckets += Response.Buckets.Num();
+
+		TBitArray<> DivergentBuckets(false, Digest->GetNumBuckets());
+		for (const int32 Bucket : Response.Buckets)
+		{
+			if (DivergentBuckets.IsValidIndex(Bucket))
+			{
+				DivergentBuckets[Bucket] = true;
+			}
+		}
+
+		const TSet<uint32> ServerKeyHashes(Response.KeyHashes);
+		TArray<FRecordKey> StaleKeys;
+		for (const FNeoDataEntry& Entry : DataMap.Items)
+		{
+			if (Entry.DigestValue != 0 && DivergentBuckets[Digest->GetBucket(Entry.DigestKeyHash)]
+				&& !ServerKeyHashes.Contains(Entry.DigestKeyHash))
+			{
+				StaleKeys.Add(Entry.Key);
+			}
+		}
+
+		if (StaleKeys.Num() > 0)
+		{
+			DataMap.RemoveBatch(StaleKeys);
+			DataMap.Stats.DigestStaleEntries += StaleKeys.Num();
+
+			// A stale override may hide a default the server holds
+			TArray<TPair<FRecordKey, bool>> DefaultKeys;
+			for (const FRecordKey& Key : StaleKeys)
+			{
+				if (DefaultValues.Contains(Key))
+				{
+					DefaultKeys.Emplace(Key, false);
+				}
+			}
+			ReconcileDefaults(DefaultKeys);
+		}
+	}
+
+	// Descend into the children that still differ
+	TArray<int32> Nodes;
+	TArray<uint64> Hashes;
+	const int32 NumNodes = FMath::Min(Response.Nodes.Num(), Response.Hashes.Num());
+	for (int32 Index = 0; Index < NumNodes; ++Index)
+	{
+		const int32 Node = Response.Nodes[Index];
+		if (Digest->IsValidNode(Node) && Digest->GetNode(Node) != Response.Hashes[Index])
+		{
+			Nodes.Add(Node);
+			Hashes.Add(Digest->GetNode(Node));
+		}
+	}
+
+	if (Nodes.Num() > 0)
+	{
+		ServerCompareDigest(Nodes, Hashes);
+		return;
+	}
+
+	OnStateDigestVerified.Broadcast(DigestRoundBuckets == 0, DigestRoundBuckets);
+}
+
+bool UNeoReplicatedDataComponent::CanSendStaticStubs(const UNetConnection* Connection) const
+{
+	const AActor* Actor = GetOwner();
+	return Connection && !Connection->IsReplay() && Actor && Actor->GetNetConnection() == Connection;
+}
+
+void UNeoReplicatedDataComponent::FlushStaticRequests()
+{
+	if (PendingStaticHashes.IsEmpty())
+	{
+		return;
+	}
+
+	const TArray<uint64> Hashes = PendingStaticHashes.Array();
+	PendingStaticHashes.Reset();
+
+	const int32 BatchSize = FMath::Max(GNeoDataStaticEntriesPerRPC, 1);
+	for (int32 First = 0; First < Hashes.Num(); First += BatchSize)
+	{
+		ServerRequestStaticEntries(TArray<uint64>(Hashes.GetData() + First, FMath::Min(BatchSize, Hashes.Num() - First)));
+	}
+}
+
+void UNeoReplicatedDataComponent::ServerRequestStaticEntries_Implementation(const TArray<uint64>& Hashes)
+{
+	// Bounded like the client's batches; a hash the server no longer has was overwritten and replicates anew
+	TSet<uint64> Requested;
+	const int32 NumHashes = FMath::Min(Hashes.Num(), FMath::Max(GNeoDataStaticEntriesPerRPC, 1));
+	for (int32 Index = 0; Index < NumHashes; ++Index)
+	{
+		Requested.Add(Hashes[Index]);
+	}
+
+	TArray<FNeoDataStaticPayload> Payloads;
+	for (const FNeoDataEntry& Entry : DataMap.Items)
+	{
+		if (Entry.HasFlags(ENeoDataEntryFlags::Static) && Requested.Remove(Entry.StaticHash) > 0)
+		{
+			FNeoDataStaticPayload& Payload = Payloads.AddDefaulted_GetRef();
+			Payload.Hash = Entry.StaticHash;
+			Payload.Value = Entry.Value;
+
+			if (Requested.IsEmpty())
+			{
+				break;
+			}
+		}
+	}
+
+	if (Payloads.Num() > 0)
+	{
+		DataMap.Stats.StaticEntriesServed += Payloads.Num();
+		ClientStaticEntries(Payloads);
+	}
+}
+
+void UNeoReplicatedDataComponent::ClientStaticEntries_Implementation(const TArray<FNeoDataStaticPayload>& Payloads)
+{
+	FNeoDataStaticCache& Cache = FNeoDataStaticCache::Get();
+	TMap<uint64, const FRecordDefinition*> ValuesByHash;
+	for (const FNeoDataStaticPayload& Payload : Payloads)
+	{
+		// The disk cache outlives this server: only persist values that are what their hash says. A quantizing net
+		// serializer can also cause a mismatch, so the value still fills this session's entries.
+		if (FNeoDataStaticCache::HashValue(Payload.Value.Payload) == Payload.Hash)
+		{
+			Cache.Add(Payload.Hash, Payload.Value.Payload);
+		}
+		else
+		{
+			++DataMap.Stats.StaticHashMismatches;
+		}
+		ValuesByHash.Add(Payload.Hash, &Payload.Value);
+	}
+	DataMap.Stats.StaticEntriesFetched += Payloads.Num();
+
+	// Several keys may share one value
+	TArray<TPair<int32, bool>> Filled;
+	for (int32 Index = 0; Index < DataMap.Items.Num(); ++Index)
+	{
+		const FNeoDataEntry& Entry = DataMap.Items[Index];
+		const FRecordDefinition* const* Value = Entry.bAwaitingStatic ? ValuesByHash.Find(Entry.StaticHash) : nullptr;
+		if (!Value)
+		{
+			continue;
+		}
+
+		DataMap.Items[Index].Value = **Value;
+		Filled.Emplace(Index, Entry.bStaticAddPending);
+		Entry.bAwaitingStatic = false;
+		Entry.bStaticAddPending = false;
+	}
+
+	// Through the receive path, so a filled transaction write completes its transaction instead of firing alone
+	BeginReplicatedReceive();
+	for (const TPair<int32, bool>& Fill : Filled)
+	{
+		const FNeoDataEntry& Entry = DataMap.Items[Fill.Key];
+		if (Fill.Value)
+		{
+			NotifyKeyAdded(Entry.Key, Entry.Value, Entry.TransactionId);
+		}
+		else
+		{
+			NotifyKeyUpdated(Entry.Key, Entry.Value, Entry.TransactionId);
+		}
+	}
+	EndReplicatedReceive();
+}
+
+bool UNeoReplicatedDataComponent::BeginResyncSend(UNetConnection* Connection, bool bInitialSend, FNeoDataResyncFilter& OutFilter)
+{
+	if (!bEnableReconnectResync || !Connection || Connection->IsReplay())
+	{
+		return false;
+	}
+
+	if (!StateEpoch.IsValid())
+	{
+		StateEpoch = FGuid::NewGuid();
+	}
+
+	const AActor* Actor = GetOwner();
+	if (!Actor || Actor->GetNetConnection() != Connection)
+	{
+		return false;
+	}
+
+	if (!Reconnect)
+	{
+		// Removals before the first send cannot be in any client's cache, so logging starts here
+		Reconnect = MakeUnique<FNeoDataReconnect>(ReconnectTombstoneCapacity);
+		DataMap.Reconnect = Reconnect.Get();
+	}
+
+	FNeoDataReconnect::FConnection* State = Reconnect->Connections.Find(Connection);
+	if (!State)
+	{
+		if (!bInitialSend)
+		{
+			return false;
+		}
+		State = &Reconnect->Connections.Add(Connection);
+
+		// A client without the feature or without a cache may never answer; send everything after the timeout
+		if (UWorld* World = GetWorld())
+		{
+			FTimerHandle TimeoutHandle;
+			World->GetTimerManager().SetTimer(TimeoutHandle, FTimerDelegate::CreateWeakLambda(this,
+				[this, ConnectionKey = TObjectKey<UNetConnection>(Connection)]()
+				{
+					const FNeoDataReconnect::FConnection* Pending = Reconnect ? Reconnect->Connections.Find(ConnectionKey) : nullptr;
+					if (Pending && Pending->Phase == FNeoDataReconnect::EPhase::AwaitingReport)
+					{
+						Reconnect->Connections.Remove(ConnectionKey);
+						DataMap.MarkArrayDirty();
+					}
+				}), FMath::Max(ReconnectReportTimeout, UE_KINDA_SMALL_NUMBER), false);
+		}
+	}
+
+	OutFilter.bWithholdAll = State->Phase == FNeoDataReconnect::EPhase::AwaitingReport;
+	OutFilter.ClientVersion = State->ClientVersion;
+	return true;
+}
+
+TSharedPtr<INetDeltaBaseState> UNeoReplicatedDataComponent::TakeDigestRepairState(UNetConnection* Connection, const INetDeltaBaseState* OldState)
+{
+	FNeoDataDigestRepair* Repair = Connection && !DigestRepairs.IsEmpty() ? DigestRepairs.Find(Connection) : nullptr;
+	if (!Repair || Repair->ResendIDs.IsEmpty())
+	{
+		return nullptr;
+	}
+
+	const TSet<int32> ResendIDs = MoveTemp(Repair->ResendIDs);
+	Repair->ResendIDs.Reset();
+
+	// An initial send carries every entry anyway
+	if (!OldState)
+	{
+		return nullptr;
+	}
+
+	// Mismatched ReplicationKeys make the divergent entries changed for this send. The array key stays INDEX_NONE
+	// so the array is compared even though it did not change; other connections' base states are untouched.
+	// Base states are only version stamped when reconnect resync is on.
+	TSharedPtr<FNeoDataBaseState> RepairState = MakeShared<FNeoDataBaseState>();
+	RepairState->IDToCLMap = static_cast<const FNetFastTArrayBaseState*>(OldState)->IDToCLMap;
+	if (bEnableReconnectResync && !Connection->IsInternalAck())
+	{
+		RepairState->Version = static_cast<const FNeoDataBaseState*>(OldState)->Version;
+	}
+	for (const int32 ReplicationID : ResendIDs)
+	{
+		if (int32* ReplicationKey = RepairState->IDToCLMap.Find(ReplicationID))
+		{
+			*ReplicationKey = INDEX_NONE;
+		}
+	}
+	return RepairState;
+}
+
+void UNeoReplicatedDataComponent::EndResyncSend(UNetConnection* Connection, const FNetDeltaSerializeInfo& DeltaParms, const FNeoDataResyncFilter& Filter)
+{
+	// Without a new base state the array was unchanged and no entry was looked at; filter the next send instead
+	if (Filter.bWithholdAll || !Reconnect || !DeltaParms.NewState || !DeltaParms.NewState->IsValid())
+	{
+		return;
+	}
+
+	// Record the skipped entries as already sent: later changes go out as updates, removals as deletes
+	FNetFastTArrayBaseState* NewState = static_cast<FNetFastTArrayBaseState*>(DeltaParms.NewState->Get());
+	for (const TPair<int32, int32>& Skipped : Filter.Skipped)
+	{
+		NewState->IDToCLMap.Add(Skipped.Key, Skipped.Value);
+	}
+
+	DataMap.Stats.ReconnectSkippedEntries += Filter.Skipped.Num();
+	Reconnect->Connections.Remove(Connection);
+}
+
+void UNeoReplicatedDataComponent::ServerReportCachedState_Implementation(const FGuid& Epoch, int64 Version)
+{
+	const AActor* Actor = GetOwner();
+	UNetConnection* Connection = Actor ? Actor->GetNetConnection() : nullptr;
+	FNeoDataReconnect::FConnection* State = Reconnect && Connection ? Reconnect->Connections.Find(Connection) : nullptr;
+	if (!State || State->Phase != FNeoDataReconnect::EPhase::AwaitingReport)
+	{
+		return;
+	}
+
+	TArray<FRecordKey> RemovedKeys;
+	const bool bDeltaAccepted = Epoch.IsValid() && Epoch == StateEpoch && Version > 0 && Version <= DataMap.GetLastVersion()
+		&& Reconnect->GetRemovedSince(Version, RemovedKeys);
+
+	if (bDeltaAccepted)
+	{
+		State->Phase = FNeoDataReconnect::EPhase::Accepted;
+		State->ClientVersion = Version;
+		++DataMap.Stats.ReconnectResyncs;
+	}
+	else
+	{
+		Reconnect->Connections.Remove(Connection);
+		RemovedKeys.Reset();
+		if (Epoch.IsValid())
+		{
+			++DataMap.Stats.ReconnectFullResyncs;
+		}
+	}
+
+	// Reliable, so the client restores its cache before the entries that follow can update it
+	ClientReconnectResync(bDeltaAccepted, RemovedKeys);
+	DataMap.MarkArrayDirty();
+}
+
+void UNeoReplicatedDataComponent::ClientReconnectResync_Implementation(bool bDeltaAccepted, const TArray<FRecordKey>& RemovedKeys)
+{
+	UNeoDataReconnectCache* Cache = UNeoDataReconnectCache::Get(this);
+	const FString CacheId = GetReconnectCacheId();
+
+	FNeoDataCachedState Cached;
+	if (!Cache || CacheId.IsEmpty() || !Cache->Take(CacheId, Cached) || !bDeltaAccepted)
+	{
+		return;
+	}
+
+	if (RemovedKeys.Num() > 0)
+	{
+		const TSet<FRecordKey> Removed(RemovedKeys);
+		Cached.Items.RemoveAllSwap([&Removed](const FNeoDataEntry& Entry) { return Removed.Contains(Entry.Key); });
+	}
+
+	const int32 NumRestored = DataMap.RestoreEntries(MoveTemp(Cached.Items));
+	DataMap.Stats.ReconnectRestoredEntries += NumRestored;
+
+	if (NumRestored > 0)
+	{
+		OnDataReset.Broadcast();
+	}
+
+	// The watermark already covers every skipped entry; a digest check also catches entries changed outside replication
+	if (Digest)
+	{
+		VerifyStateDigest();
+	}
+}
+
+void UNeoReplicatedDataComponent::LoadDefaults()
+{
+	if (DefaultsAsset && DefaultValues.IsEmpty())
+	{
+		DefaultsAsset->GetDefaults(DefaultValues);
+		for (auto It = DefaultValues.CreateIterator(); It; ++It)
+		{
+			if (!PassesSchema(It->Key, It->Value, TEXT("DefaultsAsset")))
+			{
+				It.RemoveCurrent();
+			}
+		}
+
+		// Replicated from the server for clients to compare with their own cook
+		DefaultsHash = DefaultsAsset->ContentHash;
+
+		DataMap.Items.Reserve(DataMap.Items.Num() + DefaultValues.Num());
+		for (const TPair<FRecordKey, FRecordDefinition>& Pair : DefaultValues)
+		{
+			if (DataMap.IndexOfKey(Pair.Key) == INDEX_NONE && !RemovedDefaults.Contains(Pair.Key))
+			{
+				DataMap.AddDefaultEntry(Pair.Key, Pair.Value);
+				++DataMap.Stats.DefaultEntries;
+			}
+		}
+	}
+
+	DataMap.Defaults = DefaultValues.IsEmpty() ? nullptr : &DefaultValues;
+}
+
+void UNeoReplicatedDataComponent::HandleDefaultKeyChanged(const FRecordKey& Key, bool bRemoved)
+{
+	// Clients follow RemovedDefaults; their own removals (stale digest entries) are reconciled by the caller
+	if (GetOwnerRole() != ROLE_Authority)
+	{
+		return;
+	}
+
+	if (bRemoved)
+	{
+		RemovedDefaults.AddUnique(Key);
+	}
+	else
+	{
+		RemovedDefaults.RemoveSingleSwap(Key);
+	}
+}
+
+void UNeoReplicatedDataComponent::ReconcileDefaults(TConstArrayView<TPair<FRecordKey, bool>> Keys)
+{
+	for (const TPair<FRecordKey, bool>& Pair : Keys)
+	{
+		const FRecordKey& Key = Pair.Key;
+		const bool bOverrideRemoved = Pair.Value;
+		const FRecordDefinition* DefaultValue = DefaultValues.Find(Key);
+		if (!DefaultValue)
+		{
+			continue;
+		}
+
+		// The server's entry wins, then its removal, then the baked default
+		int32 OverrideIndex = DataMap.IndexOfKeyEntry(Key, false);
+		const int32 DefaultIndex = DataMap.IndexOfKeyEntry(Key, true);
+		const bool bHadDefault = DefaultIndex != INDEX_NONE;
+		const bool bWantDefault = OverrideIndex == INDEX_NONE && !RemovedDefaults.Contains(Key);
+
+		// Handles follow the key between its default entry and the server's override of it
+		int32 HandleSlot = INDEX_NONE;
+		DataMap.PendingDefaultHandles.RemoveAndCopyValue(Key, HandleSlot);
+
+		if (bWantDefault && !bHadDefault)
+		{
+			DataMap.AttachHandle(DataMap.AddDefaultEntry(Key, *DefaultValue), HandleSlot);
+			HandleSlot = INDEX_NONE;
+		}
+		else if (!bWantDefault && bHadDefault)
+		{
+			// A static override still being fetched reads as the default until its value arrives, then notifies as a change
+			if (OverrideIndex != INDEX_NONE && DataMap.Items[OverrideIndex].bAwaitingStatic)
+			{
+				FNeoDataEntry& Override = DataMap.Items[OverrideIndex];
+				Override.Value = DataMap.Items[DefaultIndex].Value;
+				Override.bStaticAddPending = false;
+			}
+
+			int32 DefaultHandleSlot = INDEX_NONE;
+			DataMap.RemoveDefaultEntry(Key, OverrideIndex != INDEX_NONE ? &DefaultHandleSlot : nullptr);
+
+			// Removal swapped the last entry into the default's index
+			OverrideIndex = DataMap.IndexOfKeyEntry(Key, false);
+			if (OverrideIndex != INDEX_NONE)
+			{
+				DataMap.AttachHandle(OverrideIndex, DefaultHandleSlot);
+			}
+		}
+		DataMap.ReleaseHandleSlot(HandleSlot);
+
+		// Notifies held by the item callbacks, relative to what listeners saw before this receive
+		if (OverrideIndex != INDEX_NONE)
+		{
+			const FNeoDataEntry& Override = DataMap.Items[OverrideIndex];
+			if (!bOverrideRemoved && !Override.bAwaitingStatic)
+			{
+				if (bHadDefault)
+				{
+					NotifyKeyUpdated(Key, Override.Value, Override.TransactionId);
+				}
+				else
+				{
+					NotifyKeyAdded(Key, Override.Value, Override.TransactionId);
+				}
+			}
+		}
+		else if (bWantDefault)
+		{
+			if (bOverrideRemoved)
+			{
+				NotifyKeyUpdated(Key, *DefaultValue);
+			}
+			else if (!bHadDefault)
+			{
+				NotifyKeyAdded(Key, *DefaultValue);
+			}
+		}
+		else if (bOverrideRemoved || bHadDefault)
+		{
+			NotifyKeyRemoved(Key);
+		}
+	}
+}
+
+void UNeoReplicatedDataComponent::OnRep_RemovedDefaults(const TArray<FRecordKey>& PreviousRemovedDefaults)
+{
+	// Keys removed or restored since the last update
+	TArray<TPair<FRecordKey, bool>> Changed;
+	for (const FRecordKey& Key : RemovedDefaults)
+	{
+		if (!PreviousRemovedDefaults.Contains(Key))
+		{
+			Changed.Emplace(Key, false);
+		}
+	}
+	for (const FRecordKey& Key : PreviousRemovedDefaults)
+	{
+		if (!RemovedDefaults.Contains(Key))
+		{
+			Changed.Emplace(Key, false);
+		}
+	}
+	ReconcileDefaults(Changed);
+}
+
+void UNeoReplicatedDataComponent::OnRep_DefaultsHash()
+{
+	const uint64 LocalHash = DefaultsAsset ? DefaultsAsset->ContentHash : 0;
+	if (DefaultsHash != 0 && LocalHash != 0 && DefaultsHash != LocalHash)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("[NeoDataSync] %s: %s differs from the server's cook; defaults the server never wrote may be out of date"),
+			*GetPathName(), *DefaultsAsset->GetPathName());
+	}
+}
+
+bool UNeoReplicatedDataComponent::PassesSchema(const FRecordKey& Key, const FRecordDefinition& Value, const TCHAR* Context) const
+{
+	return PassesSchema(NeoReplicatedData::GetKeyStruct(Key), Key.Kind, Value.Payload.GetScriptStruct(), Context);
+}
+
+bool UNeoReplicatedDataComponent::PassesSchema(const UScriptStruct* KeyStruct, ENeoRecordKeyKind KeyKind, const UScriptStruct* ValueStruct, const TCHAR* Context) const
+{
+	// 1. Validate Key Type
+	if (RestrictedKeyType)
+	{
+		if (KeyStruct != RestrictedKeyType)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("[NeoDataSync] %s Failed: Key type '%s' does not match RestrictedKeyType '%s' on Component '%s'"), 
+				Context,
+				KeyStruct ? *KeyStruct->GetName() : *UEnum::GetValueAsString(KeyKind), 
+				*GetNameSafe(RestrictedKeyType),
+				*GetNameSafe(this));
+			return false;
+		}
+	}
+
+	// 2. Validate Value Type
+	if (RestrictedValueType)
+	{
+		if (ValueStruct != RestrictedValueType)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("[NeoDataSync] %s Failed: Value type '%s' does not match RestrictedValueType '%s' on Component '%s'"), 
+				Context,
+				*GetNameSafe(ValueStruct), 
+				*GetNameSafe(RestrictedValueType),
+				*GetNameSafe(this));
+			return false;
+		}
+	}
+
+	return true;
+}
+
+void UNeoReplicatedDataComponent::SetData(const FRecordKey& InKey, const FRecordDefinition& Value)
+{
+	WriteData(InKey, Value, nullptr);
+}
+
+void UNeoReplicatedDataComponent::WriteData(const FRecordKey& InKey, const FRecordDefinition& Value, FNeoDataHandle* OutHandle)
+{
+	FNeoDataLoadScope PopulateScope(LoadTiming.PopulateSeconds, !LoadTiming.bFirstSendRecorded);
+
+	FRecordKey NormalizedKey;
+	const FRecordKey& Key = InKey.Normalize(NormalizedKey);
+
+	if (!PassesSchema(Key, Value, TEXT("SetData")))
+	{
+		return;
+	}
+
+	DataMap.AddOrUpdate(Key, Value, false, OutHandle);
+
+	// A reliable write supersedes any pending volatile traffic for the key
+	PendingVolatileKeys.Remove(Key);
+	VolatileLastWriteTimes.Remove(Key);
+}
+
+void UNeoReplicatedDataComponent::SetStaticData(const FRecordKey& InKey, const FRecordDefinition& Value)
+{
+	FRecordKey NormalizedKey;
+	const FRecordKey& Key = InKey.Normalize(NormalizedKey);
+
+	SetData(Key, Value);
+
+	// Cached values are reloaded from text in a later session, where object references would not resolve
+	const UScriptStruct* ValueStruct = Value.Payload.GetScriptStruct();
+	if (ValueStruct && ValueStruct->RefLink)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("[NeoDataSync] SetStaticData: '%s' holds object references; key '%s' is written as regular data on Component '%s'"),
+			*ValueStruct->GetName(), *Key.ToString(), *GetNameSafe(this));
+		return;
+	}
+
+	// Only if SetData stored the value (the schema may have rejected it)
+	const FRecordDefinition* Stored = DataMap.Find(Key);
+	if (Stored && Stored->Payload == Value.Payload)
+	{
+		DataMap.SetStatic(Key, FNeoDataStaticCache::HashValue(Value.Payload));
+	}
+}
+
+void UNeoReplicatedDataComponent::SetVolatileData(const FRecordKey& InKey, const FRecordDefinition& Value)
+{
+	FNeoDataLoadScope PopulateScope(LoadTiming.PopulateSeconds, !LoadTiming.bFirstSendRecorded);
+
+	FRecordKey NormalizedKey;
+	const FRecordKey& Key = InKey.Normalize(NormalizedKey);
+
+	if (!PassesSchema(Key, Value, TEXT("SetVolatileData")))
+	{
+		return;
+	}
+
+	// Transactions replicate through the fast array only
+	if (OpenTransaction)
+	{
+		SetData(Key, Value);
+		return;
+	}
+
+	if (DataMap.AddOrUpdate(Key, Value, true))
+	{
+		PendingVolatileKeys.Add(Key);
+		VolatileLastWriteTimes.Add(Key, GetWorld() ? GetWorld()->GetTimeSeconds() : 0.0);
+		UpdateTickEnabled();
+	}
+}
+
+void UNeoReplicatedDataComponent::SetDataWithTTL(const FRecordKey& InKey, const FRecordDefinition& Value, float TimeToLive)
+{
+	FNeoDataLoadScope PopulateScope(LoadTiming.PopulateSeconds, !LoadTiming.bFirstSendRecorded);
+
+	FRecordKey NormalizedKey;
+	const FRecordKey& Key = InKey.Normalize(NormalizedKey);
+
+	if (!PassesSchema(Key, Value, TEXT("SetDataWithTTL")))
+	{
+		return;
+	}
+
+	const double ExpireTime = GetServerWorldTime() + FMath::Max(TimeToLive, 0.0f);
+
+	DataMap.AddOrUpdate(Key, Value);
+
+	PendingVolatileKeys.Remove(Key);
+	VolatileLastWriteTimes.Remove(Key);
+
+	ScheduleExpiry(Key, ExpireTime);
+}
+
+void UNeoReplicatedDataComponent::ScheduleExpiry(const FRecordKey& Key, double ExpireTime)
+{
+	DataMap.SetExpireTime(Key, ExpireTime);
+
+	if (!ExpiryWheel)
+	{
+		ExpiryWheel = MakeUnique<FNeoExpiryWheel>(ExpiryResolution, GetServerWorldTime());
+	}
+	ExpiryWheel->Schedule(Key, ExpireTime);
+	UpdateTickEnabled();
+}
+
+int32 UNeoReplicatedDataComponent::BulkLoad(TArray<TPair<FRecordKey, FRecordDefinition>>&& Entries)
+{
+	FNeoDataLoadScope PopulateScope(LoadTiming.PopulateSeconds, !LoadTiming.bFirstSendRecorded);
+
+	ensureMsgf(!OpenTransaction, TEXT("BulkLoad is not transactional; its entries are written untagged"));
+
+	// Schema is per type, so check each (key type, value type) combination once
+	TMap<TPair<const UScriptStruct*, const UScriptStruct*>, bool> SchemaResults;
+	FRecordKey NormalizedKey;
+
+	Entries.RemoveAll([this, &SchemaResults, &NormalizedKey](TPair<FRecordKey, FRecordDefinition>& Pair)
+	{
+		if (&Pair.Key.Normalize(NormalizedKey) == &NormalizedKey)
+		{
+			Pair.Key = MoveTemp(NormalizedKey);
+		}
+
+		if (!RestrictedKeyType && !RestrictedValueType)
+		{
+			return false;
+		}
+
+		const TPair<const UScriptStruct*, const UScriptStruct*> Types(NeoReplicatedData::GetKeyStruct(Pair.Key), Pair.Value.Payload.GetScriptStruct());
+		if (const bool* Passed = SchemaResults.Find(Types))
+		{
+			return !*Passed;
+		}
+		return !SchemaResults.Add(Types, PassesSchema(Pair.Key, Pair.Value, TEXT("BulkLoad")));
+	});
+
+	const bool bHadVolatileState = !PendingVolatileKeys.IsEmpty() || !VolatileLastWriteTimes.IsEmpty();
+	if (bHadVolatileState)
+	{
+		for (const TPair<FRecordKey, FRecordDefinition>& Pair : Entries)
+		{
+			PendingVolatileKeys.Remove(Pair.Key);
+			VolatileLastWriteTimes.Remove(Pair.Key);
+		}
+	}
+
+	// History and change records are kept per entry even though the events are not
+	const bool bPublish = ChangeStream && ChangeStream->HasConsumers();
+	const bool bRecord = bPublish || History;
+	TArray<int32> Added;
+	TArray<int32> Updated;
+
+	const int32 NumApplied = DataMap.BulkLoad(MoveTemp(Entries), bRecord ? &Added : nullptr, bRecord ? &Updated : nullptr);
+	if (NumApplied == 0)
+	{
+		return 0;
+	}
+
+	if (bRecord)
+	{
+		const double Now = GetServerWorldTime();
+		auto Record = [this, bPublish, Now](int32 Index, ENeoDataChangeOp Op)
+		{
+			const FNeoDataEntry& Entry = DataMap.Items[Index];
+			if (History)
+			{
+				History->RecordWrite(Entry.Key, Entry.Value.Payload, Now);
+			}
+			if (bPublish)
+			{
+				ChangeStream->Publish(Op, Entry.Key, &Entry.Value, Entry.Version, Now);
+			}
+		};
+
+		for (const int32 Index : Added)
+		{
+			Record(Index, ENeoDataChangeOp::Added);
+		}
+		for (const int32 Index : Updated)
+		{
+			Record(Index, ENeoDataChangeOp::Updated);
+		}
+	}
+
+	// One event instead of one per entry; listeners re-read the map
+	OnDataReset.Broadcast();
+	return NumApplied;
+}
+
+void UNeoReplicatedDataComponent::RemoveData(const FRecordKey& InKey)
+{
+	FRecordKey NormalizedKey;
+	const FRecordKey& Key = InKey.Normalize(NormalizedKey);
+
+	DataMap.Remove(Key);
+	PendingVolatileKeys.Remove(Key);
+	VolatileLastWriteTimes.Remove(Key);
+}
+
+bool UNeoReplicatedDataComponent::CompareAndSet(const FRecordKey& InKey, int64 ExpectedVersion, const FRecordDefinition& Value, int64& OutVersion)
+{
+	FNeoDataLoadScope PopulateScope(LoadTiming.PopulateSeconds, !LoadTiming.bFirstSendRecorded);
+
+	FRecordKey NormalizedKey;
+	const FRecordKey& Key = InKey.Normalize(NormalizedKey);
+
+	OutVersion = DataMap.GetVersion(Key);
+	if (OutVersion != ExpectedVersion)
+	{
+		++DataMap.Stats.CompareAndSetFailures;
+		return false;
+	}
+
+	if (!PassesSchema(Key, Value, TEXT("CompareAndSet")))
+	{
+		return false;
+	}
+
+	// An identical value leaves the version unchanged, which is still a successful write
+	DataMap.AddOrUpdate(Key, Value);
+	PendingVolatileKeys.Remove(Key);
+	VolatileLastWriteTimes.Remove(Key);
+
+	OutVersion = DataMap.GetVersion(Key);
+	return true;
+}
+
+int64 UNeoReplicatedDataComponent::GetVersion(const FRecordKey& InKey) const
+{
+	FRecordKey NormalizedKey;
+	return DataMap.GetVersion(InKey.Normalize(NormalizedKey));
+}
+
+bool UNeoReplicatedDataComponent::GetData(const FRecordKey& InKey, FRecordDefinition& OutValue) const
+{
+	FRecordKey NormalizedKey;
+	if (const FRecordDefinition* Found = DataMap.Find(InKey.Normalize(NormalizedKey)))
+	{
+		OutValue = *Found;
+		return true;
+	}
+	return false;
+}
+
+void UNeoReplicatedDataComponent::SetDataFromMemory(const FProperty* KeyProperty, const void* KeyMemory, const UScriptStruct* ValueStruct, const void* ValueMemory)
+{
+	FNeoDataLoadScope PopulateScope(LoadTiming.PopulateSeconds, !LoadTiming.bFirstSendRecorded);
+
+	NeoReplicatedData::FKeyRef KeyRef;
+	if (!NeoReplicatedData::ResolveKey(KeyProperty, KeyMemory, KeyRef))
+	{
+		UE_LOG(LogTemp, Warning, TEXT("[NeoDataSync] SetData (Typed) Failed: '%s' cannot be used as a key on Component '%s'"),
+			*KeyProperty->GetCPPType(), *GetNameSafe(this));
+		return;
+	}
+
+	if (!PassesSchema(KeyRef.GetKeyStruct(), KeyRef.GetKind(), ValueStruct, TEXT("SetData (Typed)")))
+	{
+		return;
+	}
+
+	const int32 Index = KeyRef.IndexIn(DataMap);
+	if (Index == INDEX_NONE)
+	{
+		// A new entry needs its own key and payload allocations either way
+		FRecordDefinition Value;
+		Value.Payload.InitializeAs(ValueStruct, static_cast<const uint8*>(ValueMemory));
+		DataMap.AddOrUpdate(KeyRef.ToRecordKey(), Value);
+		return;
+	}
+
+	// A reliable write supersedes any pending volatile traffic for the key
+	const FRecordKey& Key = DataMap.Items[Index].Key;
+	PendingVolatileKeys.Remove(Key);
+	VolatileLastWriteTimes.Remove(Key);
+
+	DataMap.UpdateAtIndex(Index, ValueStruct, ValueMemory);
+}
+
+bool UNeoReplicatedDataComponent::GetDataToMemory(const FProperty* KeyProperty, const void* KeyMemory, const UScriptStruct* ValueStruct, void* OutValueMemory) const
+{
+	NeoReplicatedData::FKeyRef KeyRef;
+	if (!NeoReplicatedData::ResolveKey(KeyProperty, KeyMemory, KeyRef))
+	{
+		return false;
+	}
+
+	// An incomplete transaction is rare and short; go through the shadows with a full key then
+	if (DataMap.HasTransactionShadows())
+	{
+		const FRecordDefinition* Found = DataMap.Find(KeyRef.ToRecordKey());
+		return Found && NeoReplicatedData::CopyPayloadTo(Found->Payload, ValueStruct, OutValueMemory);
+	}
+
+	const int32 Index = KeyRef.IndexIn(DataMap);
+	return Index != INDEX_NONE && NeoReplicatedData::CopyPayloadTo(DataMap.Items[Index].Value.Payload, ValueStruct, OutValueMemory);
+}
+
+void UNeoReplicatedDataComponent::RemoveDataFromMemory(const FProperty* KeyProperty, const void* KeyMemory)
+{
+	NeoReplicatedData::FKeyRef KeyRef;
+	if (!NeoReplicatedData::ResolveKey(KeyProperty, KeyMemory, KeyRef))
+	{
+		return;
+	}
+
+	const int32 Index = KeyRef.IndexIn(DataMap);
+	if (Index == INDEX_NONE)
+	{
+		return;
+	}
+
+	// Before the removal moves another entry into Index
+	const FRecordKey& Key = DataMap.Items[Index].Key;
+	PendingVolatileKeys.Remove(Key);
+	VolatileLastWriteTimes.Remove(Key);
+
+	DataMap.RemoveAt(Index);
+}
+
+DEFINE_FUNCTION(UNeoReplicatedDataComponent::execSetStructData)
+{
+	Stack.MostRecentProperty = nullptr;
+	Stack.StepCompiledIn<FProperty>(nullptr);
+	const FProperty* KeyProperty = Stack.MostRecentProperty;
+	const void* KeyMemory = Stack.MostRecentPropertyAddress;
+
+	Stack.MostRecentProperty = nullptr;
+	Stack.StepCompiledIn<FStructProperty>(nullptr);
+	const FStructProperty* ValueProperty = CastField<FStructProperty>(Stack.MostRecentProperty);
+	const void* ValueMemory = Stack.MostRecentPropertyAddress;
+
+	P_FINISH;
+
+	P_NATIVE_BEGIN;
+	if (KeyProperty && KeyMemory && ValueProperty && ValueMemory)
+	{
+		P_THIS->SetDataFromMemory(KeyProperty, KeyMemory, ValueProperty->Struct, ValueMemory);
+	}
+	P_NATIVE_END;
+}
+
+DEFINE_FUNCTION(UNeoReplicatedDataComponent::execGetStructData)
+{
+	Stack.MostRecentProperty = nullptr;
+	Stack.StepCompiledIn<FProperty>(nullptr);
+	const FProperty* KeyProperty = Stack.MostRecentProperty;
+	const void* KeyMemory = Stack.MostRecentPropertyAddress;
+
+	Stack.MostRecentProperty = nullptr;
+	Stack.StepCompiledIn<FStructProperty>(nullptr);
+	const FStructProperty* ValueProperty = CastField<FStructProperty>(Stack.MostRecentProperty);
+	void* ValueMemory = Stack.MostRecentPropertyAddress;
+
+	P_FINISH;
+
+	P_NATIVE_BEGIN;
+	*static_cast<bool*>(RESULT_PARAM) = KeyProperty && KeyMemory && ValueProperty && ValueMemory
+		&& P_THIS->GetDataToMemory(KeyProperty, KeyMemory, ValueProperty->Struct, ValueMemory);
+	P_NATIVE_END;
+}
+
+DEFINE_FUNCTION(UNeoReplicatedDataComponent::execGetStructDataByHandle)
+{
+	P_GET_STRUCT_REF(FNeoDataHandle, Handle);
+
+	Stack.MostRecentProperty = nullptr;
+	Stack.StepCompiledIn<FStructProperty>(nullptr);
+	const FStructProperty* ValueProperty = CastField<FStructProperty>(Stack.MostRecentProperty);
+	void* ValueMemory = Stack.MostRecentPropertyAddress;
+
+	P_FINISH;
+
+	P_NATIVE_BEGIN;
+	const FRecordDefinition* Found = ValueProperty && ValueMemory ? P_THIS->DataMap.Find(Handle) : nullptr;
+	*static_cast<bool*>(RESULT_PARAM) = Found && NeoReplicatedData::CopyPayloadTo(Found->Payload, ValueProperty->Struct, ValueMemory);
+	P_NATIVE_END;
+}
+
+DEFINE_FUNCTION(UNeoReplicatedDataComponent::execRemoveStructData)
+{
+	Stack.MostRecentProperty = nullptr;
+	Stack.StepCompiledIn<FProperty>(nullptr);
+	const FProperty* KeyProperty = Stack.MostRecentProperty;
+	const void* KeyMemory = Stack.MostRecentPropertyAddress;
+
+	P_FINISH;
+
+	P_NATIVE_BEGIN;
+	if (KeyProperty && KeyMemory)
+	{
+		P_THIS->RemoveDataFromMemory(KeyProperty, KeyMemory);
+	}
+	P_NATIVE_END;
+}
+
+FNeoDataHandle UNeoReplicatedDataComponent::FindHandle(const FRecordKey& InKey) const
+{
+	FRecordKey NormalizedKey;
+	return DataMap.FindHandle(InKey.Normalize(NormalizedKey));
+}
+
+bool UNeoReplicatedDataComponent::IsHandleValid(const FNeoDataHandle& Handle) const
+{
+	return DataMap.Find(Handle) != nullptr;
+}
+
+bool UNeoReplicatedDataComponent::GetDataByHandle(const FNeoDataHandle& Handle, FRecordDefinition& OutValue) const
+{
+	if (const FRecordDefinition* Found = DataMap.Find(Handle))
+	{
+		OutValue = *Found;
+		return true;
+	}
+	return false;
+}
+
+TArray<FRecordKey> UNeoReplicatedDataComponent::GetKeys() const
+{
+	TArray<FRecordKey> Keys;
+	DataMap.GetKeys(Keys);
+	return Keys;
+}
+
+FNeoDataChangeStream& UNeoReplicatedDataComponent::GetChangeStream()
+{
+	if (!ChangeStream)
+	{
+		ChangeStream = MakeUnique<FNeoDataChangeStream>();
+	}
+	return *ChangeStream;
+}
+
+bool UNeoReplicatedDataComponent::GetDataAtTime(const FRecordKey& InKey, double Time, FRecordDefinition& OutValue) const
+{
+	if (!History)
+	{
+		return false;
+	}
+
+	FRecordKey NormalizedKey;
+	return History->FindValueAtTime(InKey.Normalize(NormalizedKey), Time, OutValue.Payload);
+}
+
+bool UNeoReplicatedDataComponent::GetRemainingTTL(const FRecordKey& InKey, float& OutSeconds) const
+{
+	FRecordKey NormalizedKey;
+	const int32 Index = DataMap.IndexOfKey(InKey.Normalize(NormalizedKey));
+	if (Index == INDEX_NONE || DataMap.Items[Index].ExpireTime <= 0.0)
+	{
+		return false;
+	}
+
+	OutSeconds = FMath::Max(0.0, DataMap.Items[Index].ExpireTime - GetServerWorldTime());
+	return true;
+}
+
+FNeoDataMapStats UNeoReplicatedDataComponent::GetStats() const
+{
+	return DataMap.Stats;
+}
+
+FNeoDataMemoryUsage UNeoReplicatedDataComponent::GetMemoryUsage() const
+{
+	FNeoDataMemoryUsage Usage;
+	DataMap.GetMemoryUsage(Usage);
+
+	if (History)
+	{
+		Usage.CacheBytes += History->GetAllocatedSize();
+	}
+	if (Digest)
+	{
+		Usage.IndexBytes += Digest->GetAllocatedSize();
+	}
+	if (Reconnect)
+	{
+		Usage.CacheBytes += Reconnect->GetAllocatedSize();
+	}
+	Usage.CacheBytes += DefaultValues.GetAllocatedSize() + RemovedDefaults.GetAllocatedSize();
+	Usage.CacheBytes += VolatileLastWriteTimes.GetAllocatedSize() + Interpolations.GetAllocatedSize();
+	return Usage;
+}
+
+void UNeoReplicatedDataComponent::GetResourceSizeEx(FResourceSizeEx& CumulativeResourceSize)
+{
+	Super::GetResourceSizeEx(CumulativeResourceSize);
+	CumulativeResourceSize.AddDedicatedSystemMemoryBytes(GetMemoryUsage().GetTotalBytes());
+}
+
+bool UNeoReplicatedDataComponent::IsApplyingReplayScrub() const
+{
+	const UWorld* World = GetWorld();
+	const UDemoNetDriver* DemoDriver = World ? World->GetDemoNetDriver() : nullptr;
+	return DemoDriver && (DemoDriver->IsLoadingCheckpoint() || DemoDriver->IsFastForwarding());
+}
+
+void UNeoReplicatedDataComponent::HandleReplayScrubComplete(UWorld* InWorld)
+{
+	if (InWorld != GetWorld() || !bReplayScrubPending)
+	{
+		return;
+	}
+
+	bReplayScrubPending = false;
+	++DataMap.Stats.ReplayScrubs;
+
+	// Blends, history and transactions in flight refer to the timeline we scrubbed away from
+	Interpolations.Reset();
+	PendingTransactions.Reset();
+	DataMap.ReleaseTransactionShadows([](int32) { return false; });
+	if (History)
+	{
+		History = MakeUnique<FNeoDataHistory>(HistoryCapacity);
+	}
+
+	OnDataReset.Broadcast();
+}
+
+void UNeoReplicatedDataComponent::NotifyKeyAdded(const FRecordKey& Key, const FRecordDefinition& Value, int32 TransactionId) const
+{
+	if (OpenTransaction || IsHeldDuringReceive(FNeoDeferredNotify::EType::Added, Key, TransactionId) || IsApplyingReplayScrub())
+	{
+		DeferOrDispatch(FNeoDeferredNotify{ FNeoDeferredNotify::EType::Added, Key, Value, TransactionId });
+		return;
+	}
+
+	DispatchNotify(FNeoDeferredNotify::EType::Added, Key, &Value);
+}
+
+void UNeoReplicatedDataComponent::NotifyKeyUpdated(const FRecordKey& Key, const FRecordDefinition& Value, int32 TransactionId) const
+{
+	if (OpenTransaction || IsHeldDuringReceive(FNeoDeferredNotify::EType::Updated, Key, TransactionId) || IsApplyingReplayScrub())
+	{
+		DeferOrDispatch(FNeoDeferredNotify{ FNeoDeferredNotify::EType::Updated, Key, Value, TransactionId });
+		return;
+	}
+
+	DispatchNotify(FNeoDeferredNotify::EType::Updated, Key, &Value);
+}
+
+void UNeoReplicatedDataComponent::NotifyKeyRemoved(const FRecordKey& Key) const
+{
+	if (OpenTransaction || IsHeldDuringReceive(FNeoDeferredNotify::EType::Removed, Key, 0) || IsApplyingReplayScrub())
+	{
+		DeferOrDispatch(FNeoDeferredNotify{ FNeoDeferredNotify::EType::Removed, Key, FRecordDefinition(), 0 });
+		return;
+	}
+
+	DispatchNotify(FNeoDeferredNotify::EType::Removed, Key, nullptr);
+}
+
+bool UNeoReplicatedDataComponent::IsHeldDuringReceive(FNeoDeferredNotify::EType Type, const FRecordKey& Key, int32 TransactionId) const
+{
+	if (!bReceiving)
+	{
+		return false;
+	}
+
+	// Transaction parts and manifests are sorted at the end of the receive. Removals carry no transaction id and are
+	// matched by key, so they wait too; later notifies of a key with one waiting keep their order behind it.
+	return TransactionId != 0 || Key.IsTransaction() || Type == FNeoDeferredNotify::EType::Removed
+		|| ReceiveQueue.ContainsByPredicate([&Key](const FNeoDeferredNotify& Held) { return Held.Key == Key; });
+}
+
+void UNeoReplicatedDataComponent::DeferOrDispatch(FNeoDeferredNotify&& Notify) const
+{
+	// Scrubs replay the whole map; one OnDataReset afterwards replaces thousands of per-key events
+	if (IsApplyingReplayScrub())
+	{
+		bReplayScrubPending = true;
+		return;
+	}
+
+	if (OpenTransaction)
+	{
+		FNeoOpenTransaction& Transaction = *OpenTransaction;
+		switch (Notify.Type)
+		{
+		case FNeoDeferredNotify::EType::Added:
+			Transaction.WrittenKeys.Add(Notify.Key);
+			Transaction.AddedKeys.Add(Notify.Key);
+			// Removed and re-added: the client sees the new entry, not a removal to wait for
+			Transaction.RemovedKeys.Remove(Notify.Key);
+			break;
+
+		case FNeoDeferredNotify::EType::Updated:
+			Transaction.WrittenKeys.Add(Notify.Key);
+			break;
+
+		case FNeoDeferredNotify::EType::Removed:
+			Transaction.WrittenKeys.Remove(Notify.Key);
+			// Keys added and removed within the transaction never reach clients
+			if (!Transaction.AddedKeys.Remove(Notify.Key))
+			{
+				Transaction.RemovedKeys.Add(Notify.Key);
+			}
+			break;
+		}
+
+		Transaction.Notifies.Add(MoveTemp(Notify));
+		return;
+	}
+
+	if (bReceiving)
+	{
+		ReceiveQueue.Add(MoveTemp(Notify));
+		return;
+	}
+
+	// Manifests are internal
+	if (!Notify.Key.IsTransaction())
+	{
+		DispatchNotify(Notify.Type, Notify.Key, Notify.Type == FNeoDeferredNotify::EType::Removed ? nullptr : &Notify.Value);
+	}
+}
+
+void UNeoReplicatedDataComponent::DispatchNotify(FNeoDeferredNotify::EType Type, const FRecordKey& Key, const FRecordDefinition* Value) const
+{
+	if (Key.IsTransaction())
+	{
+		return;
+	}
+
+	if (Type == FNeoDeferredNotify::EType::Removed)
+	{
+		Interpolations.Remove(Key);
+		if (History)
+		{
+			History->RecordRemove(Key, GetServerWorldTime());
+		}
+		if (ChangeStream && ChangeStream->HasConsumers())
+		{
+			ChangeStream->Publish(ENeoDataChangeOp::Removed, Key, nullptr, 0, GetServerWorldTime());
+		}
+		OnKeyRemoved.Broadcast(Key);
+		return;
+	}
+
+	check(Value);
+	UpdateInterpolation(Key, *Value);
+	if (History)
+	{
+		History->RecordWrite(Key, Value->Payload, GetServerWorldTime());
+	}
+	if (ChangeStream && ChangeStream->HasConsumers())
+	{
+		const ENeoDataChangeOp Op = Type == FNeoDeferredNotify::EType::Added ? ENeoDataChangeOp::Added : ENeoDataChangeOp::Updated;
+		ChangeStream->Publish(Op, Key, Value, DataMap.GetVersion(Key), GetServerWorldTime());
+	}
+
+	if (Type == FNeoDeferredNotify::EType::Added)
+	{
+		OnKeyAdded.Broadcast(Key, *Value);
+	}
+	else
+	{
+		OnKeyUpdated.Broadcast(Key, *Value);
+	}
+
+	if (const TSharedPtr<FOnNeoDataKeyWatched>* Found = KeyWatchers.Find(Key))
+	{
+		// Callbacks may unwatch (emptying and removing the entry) or watch other keys while this runs
+		const TSharedPtr<FOnNeoDataKeyWatched> Watchers = *Found;
+		Watchers->Broadcast(Key, *Value);
+	}
+}
+
+FDelegateHandle UNeoReplicatedDataComponent::WatchKey(const FRecordKey& InKey, FOnNeoDataKeyWatched::FDelegate&& Callback)
+{
+	FRecordKey NormalizedKey;
+	TSharedPtr<FOnNeoDataKeyWatched>& Watchers = KeyWatchers.FindOrAdd(InKey.Normalize(NormalizedKey));
+	if (!Watchers)
+	{
+		Watchers = MakeShared<FOnNeoDataKeyWatched>();
+	}
+	return Watchers->Add(MoveTemp(Callback));
+}
+
+void UNeoReplicatedDataComponent::UnwatchKey(const FRecordKey& InKey, FDelegateHandle Handle)
+{
+	FRecordKey NormalizedKey;
+	const FRecordKey& Key = InKey.Normalize(NormalizedKey);
+
+	if (const TSharedPtr<FOnNeoDataKeyWatched>* Found = KeyWatchers.Find(Key))
+	{
+		(*Found)->Remove(Handle);
+		if (!(*Found)->IsBound())
+		{
+			KeyWatchers.Remove(Key);
+		}
+	}
+}
+
+void UNeoReplicatedDataComponent::SupersedeTransactionWrite(int32 TransactionId, const FRecordKey& Key)
+{
+	if (GetOwnerRole() != ROLE_Authority)
+	{
+		return;
+	}
+
+	const int32 Index = DataMap.IndexOfKey(FRecordKey::MakeTransaction(TransactionId));
+	if (Index == INDEX_NONE)
+	{
+		return;
+	}
+
+	FNeoDataEntry& ManifestEntry = DataMap.Items[Index];
+	FNeoDataTransactionManifest* Manifest = ManifestEntry.Value.Payload.GetMutablePtr<FNeoDataTransactionManifest>();
+	if (Manifest && Manifest->WrittenKeys.RemoveSingleSwap(Key) > 0)
+	{
+		DataMap.MarkItemDirty(ManifestEntry);
+	}
+}
+
+void UNeoReplicatedDataComponent::SupersedeTransactionRemoval(const FRecordKey& Key)
+{
+	int32 TransactionId = 0;
+	if (TransactionRemovals.IsEmpty() || !TransactionRemovals.RemoveAndCopyValue(Key, TransactionId))
+	{
+		return;
+	}
+
+	const int32 Index = DataMap.IndexOfKey(FRecordKey::MakeTransaction(TransactionId));
+	if (Index == INDEX_NONE)
+	{
+		return;
+	}
+
+	// Clients never see a removal followed by a re-add within one delta, only the new entry
+	FNeoDataEntry& ManifestEntry = DataMap.Items[Index];
+	FNeoDataTransactionManifest* Manifest = ManifestEntry.Value.Payload.GetMutablePtr<FNeoDataTransactionManifest>();
+	if (Manifest && Manifest->RemovedKeys.RemoveSingleSwap(Key) > 0)
+	{
+		DataMap.MarkItemDirty(ManifestEntry);
+	}
+}
+
+void UNeoReplicatedDataComponent::DispatchTransaction(int32 TransactionId, const TArray<FNeoDeferredNotify>& Notifies) const
+{
+	TArray<FRecordKey> Keys;
+	Keys.Reserve(Notifies.Num());
+	for (const FNeoDeferredNotify& Notify : Notifies)
+	{
+		DispatchNotify(Notify.Type, Notify.Key, Notify.Type == FNeoDeferredNotify::EType::Removed ? nullptr : &Notify.Value);
+		Keys.AddUnique(Notify.Key);
+	}
+
+	OnTransactionApplied.Broadcast(TransactionId, Keys);
+}
+
+bool UNeoReplicatedDataComponent::IsTransactionComplete(int32 TransactionId, const FNeoPendingTransaction& Transaction) const
+{
+	// Manifest expired before the rest arrived: release what we have rather than hold it forever
+	if (DataMap.IndexOfKey(FRecordKey::MakeTransaction(TransactionId)) == INDEX_NONE)
+	{
+		return true;
+	}
+
+	return Transaction.PendingWrites.IsEmpty() && Transaction.PendingRemovals.IsEmpty();
+}
+
+void UNeoReplicatedDataComponent::EndReplicatedReceive() const
+{
+	bReceiving = false;
+	if (ReceiveQueue.IsEmpty() && PendingTransactions.IsEmpty() && !DataMap.HasTransactionShadows())
+	{
+		return;
+	}
+
+	TArray<FNeoDeferredNotify> Queue = MoveTemp(ReceiveQueue);
+	ReceiveQueue.Reset();
+
+	// Removals of this receive already left the map; their notifications are sorted below
+	TSet<FRecordKey> ReceivedRemovals;
+	bool bReceivedRemovalsGathered = false;
+
+	// Register manifests first: within a delta they are applied after the writes they describe
+	for (const FNeoDeferredNotify& Notify : Queue)
+	{
+		const FNeoDataTransactionManifest* Manifest = Notify.Key.IsTransaction() && Notify.Type != FNeoDeferredNotify::EType::Removed
+			? Notify.Value.Payload.GetPtr<FNeoDataTransactionManifest>() : nullptr;
+		if (!Manifest)
+		{
+			continue;
+		}
+
+		const int32 TransactionId = static_cast<int32>(Notify.Key.IntKey);
+		if (Notify.Type == FNeoDeferredNotify::EType::Updated)
+		{
+			// The server dropped superseded parts; stop waiting for them
+			if (FNeoPendingTransaction* Transaction = PendingTransactions.Find(TransactionId))
+			{
+				Transaction->PendingWrites = Transaction->PendingWrites.Intersect(TSet<FRecordKey>(Manifest->WrittenKeys));
+				Transaction->PendingRemovals = Transaction->PendingRemovals.Intersect(TSet<FRecordKey>(Manifest->RemovedKeys));
+			}
+			continue;
+		}
+
+		if (!bReceivedRemovalsGathered)
+		{
+			for (const FNeoDeferredNotify& Removal : Queue)
+			{
+				if (Removal.Type == FNeoDeferredNotify::EType::Removed && !Removal.Key.IsTransaction())
+				{
+					ReceivedRemovals.Add(Removal.Key);
+				}
+			}
+			bReceivedRemovalsGathered = true;
+		}
+
+		// Parts applied in earlier receives are already in the map
+		FNeoPendingTransaction& Transaction = PendingTransactions.FindOrAdd(TransactionId);
+		for (const FRecordKey& Key : Manifest->WrittenKeys)
+		{
+			const int32 Index = DataMap.IndexOfKeyEntry(Key, false);
+			if (Index == INDEX_NONE || DataMap.Items[Index].TransactionId != TransactionId || DataMap.Items[Index].bAwaitingStatic)
+			{
+				Transaction.PendingWrites.Add(Key);
+			}
+		}
+		for (const FRecordKey& Key : Manifest->RemovedKeys)
+		{
+			if (DataMap.IndexOfKeyEntry(Key, false) != INDEX_NONE || ReceivedRemovals.Contains(Key))
+			{
+				Transaction.PendingRemovals.Add(Key);
+			}
+		}
+	}
+
+	TArray<FNeoDeferredNotify> Untransacted;
+	for (FNeoDeferredNotify& Notify : Queue)
+	{
+		if (Notify.Key.IsTransaction())
+		{
+			continue;
+		}
+
+		FNeoPendingTransaction* Transaction = nullptr;
+		if (Notify.Type == FNeoDeferredNotify::EType::Removed)
+		{
+			int32 RemovalTransactionId = 0;
+			for (TPair<int32, FNeoPendingTransaction>& Pending : PendingTransactions)
+			{
+				if (Pending.Value.PendingRemovals.Remove(Notify.Key) > 0)
+				{
+					Transaction = &Pending.Value;
+					RemovalTransactionId = Pending.Key;
+					break;
+				}
+			}
+			DataMap.AssignTransactionShadow(Notify.Key, RemovalTransactionId);
+		}
+		else if (Notify.TransactionId != 0)
+		{
+			Transaction = PendingTransactions.Find(Notify.TransactionId);
+			if (Transaction)
+			{
+				Transaction->PendingWrites.Remove(Notify.Key);
+			}
+		}
+
+		if (Transaction)
+		{
+			Transaction->Notifies.Add(MoveTemp(Notify));
+		}
+		else
+		{
+			Untransacted.Add(MoveTemp(Notify));
+		}
+	}
+
+	TArray<TPair<int32, TArray<FNeoDeferredNotify>>> Completed;
+	for (auto It = PendingTransactions.CreateIterator(); It; ++It)
+	{
+		if (IsTransactionComplete(It->Key, It->Value))
+		{
+			Completed.Emplace(It->Key, MoveTemp(It->Value.Notifies));
+			It.RemoveCurrent();
+		}
+	}
+
+	// Readers see everything but what incomplete transactions still hold back before anyone is notified
+	if (DataMap.HasTransactionShadows())
+	{
+		DataMap.ReleaseTransactionShadows([this](int32 TransactionId) { return PendingTransactions.Contains(TransactionId); });
+	}
+
+	for (const FNeoDeferredNotify& Notify : Untransacted)
+	{
+		DispatchNotify(Notify.Type, Notify.Key, Notify.Type == FNeoDeferredNotify::EType::Removed ? nullptr : &Notify.Value);
+	}
+
+	for (const TPair<int32, TArray<FNeoDeferredNotify>>& Transaction : Completed)
+	{
+		DispatchTransaction(Transaction.Key, Transaction.Value);
+	}
+}
+
+int32 UNeoReplicatedDataComponent::BeginTransaction()
+{
+	if (!OpenTransaction)
+	{
+		// Never 0, which marks untransacted entries
+		LastTransactionId = LastTransactionId == MAX_int32 ? 1 : LastTransactionId + 1;
+
+		OpenTransaction.Emplace();
+		OpenTransaction->TransactionId = LastTransactionId;
+		DataMap.SetActiveTransaction(LastTransactionId);
+	}
+
+	++OpenTransaction->Depth;
+	return OpenTransaction->TransactionId;
+}
+
+void UNeoReplicatedDataComponent::CommitTransaction()
+{
+	if (!OpenTransaction)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("[NeoDataSync] CommitTransaction without BeginTransaction on Component '%s'"), *GetName());
+		return;
+	}
+
+	if (--OpenTransaction->Depth > 0)
+	{
+		return;
+	}
+
+	FNeoOpenTransaction Transaction = MoveTemp(*OpenTransaction);
+	OpenTransaction.Reset();
+
+	if (!Transaction.Notifies.IsEmpty())
+	{
+		// Added last so it goes out in the same delta as the entries it describes
+		FNeoDataTransactionManifest Manifest;
+		Manifest.WrittenKeys = Transaction.WrittenKeys.Array();
+		Manifest.RemovedKeys = Transaction.RemovedKeys.Array();
+
+		const FRecordKey ManifestKey = FRecordKey::MakeTransaction(Transaction.TransactionId);
+		DataMap.AddOrUpdate(ManifestKey, FRecordDefinition(FInstancedStruct::Make(Manifest)));
+		ScheduleExpiry(ManifestKey, GetServerWorldTime() + TransactionManifestLifetime);
+
+		for (const FRecordKey& RemovedKey : Manifest.RemovedKeys)
+		{
+			TransactionRemovals.Add(RemovedKey, Transaction.TransactionId);
+		}
+	}
+
+	DataMap.SetActiveTransaction(0);
+
+	if (!Transaction.Notifies.IsEmpty())
+	{
+		DispatchTransaction(Transaction.TransactionId, Transaction.Notifies);
+	}
+}
+
+const TArray<const FProperty*>* UNeoReplicatedDataComponent::FindInterpolatedProperties(const UScriptStruct* ValueStruct) const
+{
+	if (!ValueStruct || InterpolationRules.IsEmpty())
+	{
+		return nullptr;
+	}
+
+	if (const TArray<const FProperty*>* Cached = InterpolatedPropertyCache.Find(ValueStruct))
+	{
+		return Cached->IsEmpty() ? nullptr : Cached;
+	}
+
+	TArray<const FProperty*>& Properties = InterpolatedPropertyCache.Add(ValueStruct);
+	for (const FNeoInterpolationRule& Rule : InterpolationRules)
+	{
+		if (Rule.ValueType != ValueStruct)
+		{
+			continue;
+		}
+
+		if (Rule.Properties.IsEmpty())
+		{
+			for (TFieldIterator<FProperty> It(ValueStruct); It; ++It)
+			{
+				if (NeoDataInterpolation::IsInterpolatable(*It))
+				{
+					Properties.AddUnique(*It);
+				}
+			}
+			continue;
+		}
+
+		for (const FName& PropertyName : Rule.Properties)
+		{
+			const FProperty* Property = FindFProperty<FProperty>(ValueStruct, PropertyName);
+			if (Property && NeoDataInterpolation::IsInterpolatable(Property))
+			{
+				Properties.AddUnique(Property);
+			}
+			else
+			{
+				UE_LOG(LogTemp, Warning, TEXT("[NeoDataSync] Interpolation rule on Component '%s': '%s' is not a float, double, vector, rotator, quat or color property of '%s'"),
+					*GetName(), *PropertyName.ToString(), *ValueStruct->GetName());
+			}
+		}
+	}
+
+	return Properties.IsEmpty() ? nullptr : &Properties;
+}
+
+void UNeoReplicatedDataComponent::UpdateInterpolation(const FRecordKey& Key, const FRecordDefinition& Value) const
+{
+	// Smoothing is presentation on receiving clients; the authority always reads what it wrote
+	if (GetOwnerRole() == ROLE_Authority)
+	{
+		return;
+	}
+
+	const TArray<const FProperty*>* Properties = FindInterpolatedProperties(Value.Payload.GetScriptStruct());
+	if (!Properties)
+	{
+		Interpolations.Remove(Key);
+		return;
+	}
+
+	const double Now = GetWorld() ? GetWorld()->GetTimeSeconds() : 0.0;
+
+	FNeoInterpolationState* State = Interpolations.Find(Key);
+	if (!State || State->To.GetScriptStruct() != Value.Payload.GetScriptStruct())
+	{
+		// First value (or a type change): nothing to blend from
+		FNeoInterpolationState& NewState = Interpolations.Add(Key);
+		NewState.From = Value.Payload;
+		NewState.To = Value.Payload;
+		NewState.StartTime = Now;
+		NewState.LastUpdateTime = Now;
+		return;
+	}
+
+	// Start from what is on screen right now so a blend cut short by a new update does not jump
+	FInstancedStruct Displayed = State->To;
+	EvaluateInterpolation(*State, *Properties, Now, Displayed);
+
+	const double Interval = Now - State->LastUpdateTime;
+	const bool bMeasured = Interval > 0.0 && Interval <= MaxInterpolationDuration;
+
+	State->From = MoveTemp(Displayed);
+	State->To = Value.Payload;
+	State->StartTime = Now;
+	State->Duration = bMeasured ? Interval : DefaultInterpolationDuration;
+	State->LastUpdateTime = Now;
+}
+
+void UNeoReplicatedDataComponent::EvaluateInterpolation(const FNeoInterpolationState& State, TConstArrayView<const FProperty*> Properties,
+	double Now, FInstancedStruct& Out)
+{
+	const float Alpha = State.Duration > 0.0 ? static_cast<float>(FMath::Clamp((Now - State.StartTime) / State.Duration, 0.0, 1.0)) : 1.0f;
+	if (Alpha >= 1.0f || !State.From.IsValid())
+	{
+		return;
+	}
+
+	uint8* OutMemory = Out.GetMutableMemory();
+	for (const FProperty* Property : Properties)
+	{
+		NeoDataInterpolation::Blend(Property, OutMemory, State.From.GetMemory(), State.To.GetMemory(), Alpha);
+	}
+}
+
+bool UNeoReplicatedDataComponent::GetInterpolatedData(const FRecordKey& InKey, FRecordDefinition& OutValue) const
+{
+	FRecordKey NormalizedKey;
+	const FRecordKey& Key = InKey.Normalize(NormalizedKey);
+
+	const FRecordDefinition* Found = DataMap.Find(Key);
+	if (!Found)
+	{
+		return false;
+	}
+
+	OutValue = *Found;
+
+	const FNeoInterpolationState* State = Interpolations.Find(Key);
+	if (State && State->To.GetScriptStruct() == OutValue.Payload.GetScriptStruct())
+	{
+		if (const TArray<const FProperty*>* Properties = FindInterpolatedProperties(OutValue.Payload.GetScriptStruct()))
+		{
+			EvaluateInterpolation(*State, *Properties, GetWorld() ? GetWorld()->GetTimeSeconds() : 0.0, OutValue.Payload);
+		}
+	}
+	return true;
 }
\ No newline at end of file
@@ -0,0 +1,86 @@
+// Copyright 2025-2026 NeoNexus Studios. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Kismet/BlueprintAsyncActionBase.h"
+#include "Engine/TimerHandle.h"
+#include "NeoReplicatedData.h"
+
+#include "NeoDataAsyncActions.generated.h"
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FNeoDataWaitForKeyOutput, const FRecordKey&, Key, const FRecordDefinition&, Value);
+DECLARE_DYNAMIC_DELEGATE_RetVal_TwoParams(bool, FNeoDataValuePredicate, const FRecordKey&, Key, const FRecordDefinition&, Value);
+
+/**
+ * Latent wait for a key to arrive, optionally until its value passes a predicate.
+ * Woken by the component's per-key notifications (WatchKey) instead of polling GetData every tick.
+ */
+UCLASS()
+class NEODATASYNC_API UNeoDataWaitForKeyAction : public UBlueprintAsyncActionBase
+{
+	GENERATED_BODY()
+
+public:
+	/** Fires once Key is present, immediately if it already is. */
+	UPROPERTY(BlueprintAssignable)
+	FNeoDataWaitForKeyOutput OnFound;
+
+	/** Fires if Timeout seconds pass first; Value is empty. */
+	UPROPERTY(BlueprintAssignable)
+	FNeoDataWaitForKeyOutput OnTimedOut;
+
+	/** Fires if there is no component, or it ends play before the key arrives; Value is empty. */
+	UPROPERTY(BlueprintAssignable)
+	FNeoDataWaitForKeyOutput OnFailed;
+
+	/**
+	 * Waits until Component holds Key.
+	 * @param Timeout	Seconds to wait before OnTimedOut; 0 waits indefinitely.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "NeoData|Async", meta = (BlueprintInternalUseOnly = "true", DisplayName = "Wait For Key"))
+	static UNeoDataWaitForKeyAction* WaitForKey(UNeoReplicatedDataComponent* Component, const FRecordKey& Key, float Timeout = 0.0f);
+
+	/**
+	 * Waits until Key holds a value Predicate accepts. Predicate runs on the current value and on every later change of Key only.
+	 * @param Timeout	Seconds to wait before OnTimedOut; 0 waits indefinitely.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "NeoData|Async", meta = (BlueprintInternalUseOnly = "true", DisplayName = "Wait For Value Matching"))
+	static UNeoDataWaitForKeyAction* WaitForValueMatching(UNeoReplicatedDataComponent* Component, const FRecordKey& Key, FNeoDataValuePredicate Predicate, float Timeout = 0.0f);
+
+	/** Stops waiting without firing either output. */
+	UFUNCTION(BlueprintCallable, Category = "NeoData|Async")
+	void Cancel();
+
+	virtual void Activate() override;
+	virtual void SetReadyToDestroy() override;
+
+private:
+	static UNeoDataWaitForKeyAction* Create(UNeoReplicatedDataComponent* Component, const FRecordKey& Key, float Timeout);
+
+	/** Fires OnFound and finishes if Value passes the predicate. */
+	bool TryComplete(const FRecordDefinition& Value);
+
+	/** Checks the key's current value. */
+	bool TryCompleteFromMap();
+
+	void HandleKeyWatched(const FRecordKey& ChangedKey, const FRecordDefinition& Value);
+
+	UFUNCTION()
+	void HandleDataReset();
+
+	void HandleTimeout();
+
+	/** Finishes through OnFailed. */
+	void Fail();
+
+	TWeakObjectPtr<UNeoReplicatedDataComponent> Component;
+	FRecordKey Key;
+	FNeoDataValuePredicate Predicate;
+	float Timeout = 0.0f;
+
+	FDelegateHandle WatchHandle;
+	FDelegateHandle EndPlayHandle;
+	FTimerHandle TimeoutHandle;
+	bool bFinished = false;
+};
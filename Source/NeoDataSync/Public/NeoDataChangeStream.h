@@ -0,0 +1,131 @@
+// Copyright 2025-2026 NeoNexus Studios. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/CircularQueue.h"
+#include "HAL/Runnable.h"
+#include "NeoReplicatedData.h"
+#include <atomic>
+
+enum class ENeoDataChangeOp : uint8
+{
+	Added,
+	Updated,
+	Removed,
+};
+
+/** One mutation of a component's map, immutable once published and shared by every consumer. */
+struct NEODATASYNC_API FNeoDataChangeRecord
+{
+	/** Per-stream, starting at 1 and without gaps; a consumer seeing a gap has dropped records. */
+	uint64 Sequence = 0;
+
+	/** Server world time of the change. */
+	double Timestamp = 0.0;
+
+	ENeoDataChangeOp Op = ENeoDataChangeOp::Updated;
+	FRecordKey Key;
+
+	/** Entry version after the change; 0 for removals. */
+	int64 Version = 0;
+
+	/** Payload type; null for removals. */
+	const UScriptStruct* ValueType = nullptr;
+
+	/** Payload properties that differ from ValueType's defaults, self-describing (tagged). See LoadValue. */
+	TArray<uint8> Payload;
+
+	/**
+	 * Rebuilds the payload. Safe on any thread as long as ValueType stays loaded. Object references are only found,
+	 * never loaded: one whose object is not in memory comes back null.
+	 */
+	void LoadValue(FInstancedStruct& OutValue) const;
+};
+
+using FNeoDataChangeRecordPtr = TSharedPtr<const FNeoDataChangeRecord, ESPMode::ThreadSafe>;
+
+/**
+ * One reader of a change stream. Each consumer has its own bounded lock-free single-producer/single-consumer
+ * ring, so it can be drained from any one thread without blocking the game thread or other consumers.
+ * When the ring is full new records are dropped and counted rather than stalling the producer.
+ */
+class NEODATASYNC_API FNeoDataChangeConsumer
+{
+public:
+	explicit FNeoDataChangeConsumer(uint32 InCapacity);
+
+	/** Pops up to MaxRecords records in order. Call from one thread at a time. @return records visited. */
+	int32 Drain(TFunctionRef<void(const FNeoDataChangeRecord&)> Visitor, int32 MaxRecords = MAX_int32);
+
+	/** Records dropped because the ring was full. */
+	uint64 GetDroppedCount() const { return Dropped.load(std::memory_order_relaxed); }
+
+	/** Records waiting to be drained (approximate while the producer runs). */
+	uint32 GetPendingCount() const { return Queue.Count(); }
+
+	/** Most records ever waiting at once, to size Capacity. */
+	uint32 GetHighWatermark() const { return HighWatermark.load(std::memory_order_relaxed); }
+
+private:
+	friend class FNeoDataChangeStream;
+
+	/** Producer side. */
+	void Push(const FNeoDataChangeRecordPtr& Record);
+
+	TCircularQueue<FNeoDataChangeRecordPtr> Queue;
+	std::atomic<uint64> Dropped{ 0 };
+	std::atomic<uint32> HighWatermark{ 0 };
+};
+
+using FNeoDataChangeConsumerRef = TSharedRef<FNeoDataChangeConsumer, ESPMode::ThreadSafe>;
+
+/**
+ * Native change-data-capture stream of one component. Records are built once per mutation on the game thread,
+ * only while at least one consumer is attached, and shared by pointer with every consumer.
+ */
+class NEODATASYNC_API FNeoDataChangeStream
+{
+public:
+	/** Game thread. The consumer keeps receiving records until RemoveConsumer. */
+	FNeoDataChangeConsumerRef AddConsumer(uint32 Capacity = 4096);
+	void RemoveConsumer(const FNeoDataChangeConsumerRef& Consumer);
+
+	bool HasConsumers() const { return !Consumers.IsEmpty(); }
+
+	/** Game thread. Value is null for removals. */
+	void Publish(ENeoDataChangeOp Op, const FRecordKey& Key, const FRecordDefinition* Value, int64 Version, double Timestamp);
+
+	/** Sequence of the last published record. */
+	uint64 GetLastSequence() const { return NextSequence - 1; }
+
+private:
+	TArray<FNeoDataChangeConsumerRef> Consumers;
+	uint64 NextSequence = 1;
+};
+
+/**
+ * Test consumer that drains a stream on its own thread and appends one text line per record to a file:
+ * Sequence, Timestamp, Op, Version, Key, ValueType, payload size. Gaps in Sequence show dropped records.
+ */
+class NEODATASYNC_API FNeoDataChangeFileSink : public FRunnable
+{
+public:
+	FNeoDataChangeFileSink(FNeoDataChangeConsumerRef InConsumer, const FString& InFilename);
+	virtual ~FNeoDataChangeFileSink() override;
+
+	const FString& GetFilename() const { return Filename; }
+
+	// FRunnable
+	virtual uint32 Run() override;
+	virtual void Stop() override { bStopping = true; }
+
+private:
+	void DrainToFile();
+
+	FNeoDataChangeConsumerRef Consumer;
+	FString Filename;
+	TUniquePtr<FArchive> File;
+	FRunnableThread* Thread = nullptr;
+	std::atomic<bool> bStopping{ false };
+};
@@ -0,0 +1,54 @@
+// Copyright 2025-2026 NeoNexus Studios. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DataAsset.h"
+#include "NeoReplicatedData.h"
+
+#include "NeoDataDefaultsAsset.generated.h"
+
+/** One baked default: the value Key holds until the server writes something else. */
+USTRUCT(BlueprintType)
+struct NEODATASYNC_API FNeoDataDefaultEntry
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "NeoData|Defaults")
+	FRecordKey Key;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "NeoData|Defaults")
+	FRecordDefinition Value;
+};
+
+/**
+ * Default entries shipped with the client instead of replicated.
+ *
+ * A component with this asset starts with these entries on the server and on every client. Only keys the server
+ * writes to a different value, or removes, go over the network; writing the default value back stops replicating
+ * the key again. Server and clients must run the same cook of the asset: ContentHash is compared on join and a
+ * mismatch is logged, since clients would otherwise show stale defaults.
+ *
+ * Saving (and cooking) bakes Entries: keys are normalized, entries without a key or value are dropped, later
+ * duplicates of a key replace earlier ones, and ContentHash is recomputed.
+ */
+UCLASS(BlueprintType)
+class NEODATASYNC_API UNeoDataDefaultsAsset : public UDataAsset
+{
+	GENERATED_BODY()
+
+public:
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "NeoData|Defaults")
+	TArray<FNeoDataDefaultEntry> Entries;
+
+	/** Hash of the baked entries, identical in every process; 0 until the asset is saved. */
+	UPROPERTY(VisibleAnywhere, Category = "NeoData|Defaults")
+	uint64 ContentHash = 0;
+
+	/** Adds the entries to OutDefaults by normalized key, later duplicates replacing earlier ones. Skips invalid entries. */
+	void GetDefaults(TMap<FRecordKey, FRecordDefinition>& OutDefaults) const;
+
+#if WITH_EDITOR
+	virtual void PreSave(FObjectPreSaveContext ObjectSaveContext) override;
+#endif
+};
@@ -0,0 +1,61 @@
+// Copyright 2025-2026 NeoNexus Studios. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+struct FRecordKey;
+
+/**
+ * Hash tree over a map's entries for comparing server and client state.
+ *
+ * Entries hash into NumBuckets leaves by key hash. A binary tree is stored heap-style in Nodes, with the root at
+ * index 1 and the leaves at [NumBuckets, 2 * NumBuckets). Nodes combine by wrapping addition rather than by
+ * hashing their children. An entry change then adds one delta along its leaf-to-root path, O(log NumBuckets),
+ * and unequal nodes still lead down to the buckets that differ.
+ */
+class NEODATASYNC_API FNeoDataDigest
+{
+public:
+	/** NumBuckets is rounded up to a power of two within [16, 65536]. */
+	explicit FNeoDataDigest(int32 InNumBuckets);
+
+	/**
+	 * Key hash that matches across processes, unlike GetTypeHash(FRecordKey): FName and struct pointer hashes are
+	 * local. Names, tags and struct keys hash their text form, so this is slower than GetTypeHash; entries cache it.
+	 */
+	static uint32 HashKey(const FRecordKey& Key);
+
+	/**
+	 * Contribution of one entry: which key and which write of it. Payload bytes are left out on purpose, because
+	 * quantizing net serializers legitimately leave client values different from the server's.
+	 * Volatile entries contribute their key only, since their unreliable versions converge late by design.
+	 */
+	static uint64 HashEntry(uint32 KeyHash, int64 Version, bool bVolatile);
+
+	int32 GetBucket(uint32 KeyHash) const { return static_cast<int32>(KeyHash & static_cast<uint32>(NumBuckets - 1)); }
+
+	/** Adds Delta to Bucket's leaf and every node above it. */
+	void Apply(int32 Bucket, uint64 Delta);
+
+	void Reset();
+
+	uint64 GetRoot() const { return Nodes[1]; }
+
+	/** Node index 1 (root) to 2 * NumBuckets - 1. */
+	bool IsValidNode(int32 Node) const { return Node >= 1 && Node < Nodes.Num(); }
+	uint64 GetNode(int32 Node) const { return Nodes[Node]; }
+
+	bool IsLeaf(int32 Node) const { return Node >= NumBuckets; }
+	int32 GetLeafBucket(int32 Node) const { return Node - NumBuckets; }
+
+	/** Appends the nodes Depth levels below Node, stopping at the leaves. */
+	void GetDescendants(int32 Node, int32 Depth, TArray<int32>& OutNodes) const;
+
+	int32 GetNumBuckets() const { return NumBuckets; }
+	SIZE_T GetAllocatedSize() const { return Nodes.GetAllocatedSize(); }
+
+private:
+	int32 NumBuckets;
+	TArray<uint64> Nodes;
+};
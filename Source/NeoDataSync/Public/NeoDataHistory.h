@@ -0,0 +1,70 @@
+// Copyright 2025-2026 NeoNexus Studios. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "NeoReplicatedData.h"
+
+/** One recorded write or removal. */
+struct FNeoDataHistoryRecord
+{
+	double Timestamp = 0.0;
+	FRecordKey Key;
+
+	/** Payload type; null for removals and empty payloads. */
+	const UScriptStruct* ValueType = nullptr;
+
+	/** Tagged serialization of the payload against ValueType's defaults: only non-default properties are stored. */
+	TArray<uint8> Delta;
+
+	/** Sequence of this key's previous record, or MAX_uint64. */
+	uint64 PrevSequence = MAX_uint64;
+
+	bool bRemoved = false;
+};
+
+/**
+ * Fixed-size ring of per-key value changes for rewind and debugging.
+ *
+ * Appending is O(1) and reuses the overwritten slot's buffer. Each record links to the previous record of
+ * the same key, so "value at time T" walks only that key's newer records instead of the whole ring.
+ * Timestamps are expected to be non-decreasing.
+ */
+class NEODATASYNC_API FNeoDataHistory
+{
+public:
+	explicit FNeoDataHistory(int32 InCapacity);
+
+	void RecordWrite(const FRecordKey& Key, const FInstancedStruct& Value, double Timestamp);
+	void RecordRemove(const FRecordKey& Key, double Timestamp);
+
+	/**
+	 * Rebuilds Key's value as of Time.
+	 * @return false if the key was absent at Time, or Time predates every record of the key still in the ring.
+	 */
+	bool FindValueAtTime(const FRecordKey& Key, double Time, FInstancedStruct& OutValue) const;
+
+	/** Calls Visitor for each of Key's records still in the ring, newest first. */
+	void ForEachRecord(const FRecordKey& Key, TFunctionRef<void(const FNeoDataHistoryRecord&)> Visitor) const;
+
+	int32 Num() const { return static_cast<int32>(FMath::Min<uint64>(NextSequence, Records.Num())); }
+	int32 GetCapacity() const { return Records.Num(); }
+
+	/** Heap memory of the ring, the recorded deltas and struct keys, and the per-key index. */
+	SIZE_T GetAllocatedSize() const;
+
+private:
+	/** Claims the next slot, unlinking the key whose oldest surviving record it held. */
+	FNeoDataHistoryRecord& Append(const FRecordKey& Key, double Timestamp);
+
+	bool IsLive(uint64 Sequence) const
+	{
+		return Sequence < NextSequence && NextSequence - Sequence <= static_cast<uint64>(Records.Num());
+	}
+
+	TArray<FNeoDataHistoryRecord> Records;
+	uint64 NextSequence = 0;
+
+	/** Sequence of each key's newest record. */
+	TMap<FRecordKey, uint64> LatestByKey;
+};
@@ -0,0 +1,194 @@
+// Copyright 2025-2026 NeoNexus Studios. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/Object.h"
+#include "NeoReplicatedData.h"
+
+#include "NeoDataListModel.generated.h"
+
+class UListView;
+class UNeoDataListItem;
+
+UENUM(BlueprintType)
+enum class ENeoDataListOpType : uint8
+{
+	/** A row was inserted at Index; rows from Index on moved down by one. */
+	Insert,
+	/** The row at Index was removed; later rows moved up by one. */
+	Remove,
+	/** The row at FromIndex now sits at Index; rows between shifted by one. */
+	Move,
+	/** The row at Index has a new value; its item object is unchanged. */
+	Update,
+	/** Rows were rebuilt from scratch (replay scrub); re-read every item. */
+	Reset,
+};
+
+USTRUCT(BlueprintType)
+struct NEODATASYNC_API FNeoDataListOp
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadOnly, Category = "NeoData|List")
+	ENeoDataListOpType Type = ENeoDataListOpType::Update;
+
+	UPROPERTY(BlueprintReadOnly, Category = "NeoData|List")
+	int32 Index = INDEX_NONE;
+
+	/** Previous index for Move; INDEX_NONE otherwise. */
+	UPROPERTY(BlueprintReadOnly, Category = "NeoData|List")
+	int32 FromIndex = INDEX_NONE;
+
+	UPROPERTY(BlueprintReadOnly, Category = "NeoData|List")
+	FRecordKey Key;
+};
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnNeoDataListItemChanged, UNeoDataListItem*, Item);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnNeoDataListChanged, const TArray<FNeoDataListOp>&, Ops);
+
+/**
+ * One row of a UNeoDataListModel. The same object represents a key for as long as it is listed,
+ * so list views keep its entry widget and only the row whose value changed refreshes.
+ */
+UCLASS(BlueprintType)
+class NEODATASYNC_API UNeoDataListItem : public UObject
+{
+	GENERATED_BODY()
+
+public:
+	UPROPERTY(BlueprintReadOnly, Category = "NeoData|List")
+	FRecordKey Key;
+
+	UPROPERTY(BlueprintReadOnly, Category = "NeoData|List")
+	FRecordDefinition Value;
+
+	/** Fired when Value changes in place. Bind in the entry widget's OnListItemObjectSet. */
+	UPROPERTY(BlueprintAssignable, Category = "NeoData|List")
+	FOnNeoDataListItemChanged OnValueChanged;
+
+private:
+	friend class UNeoDataListModel;
+
+	/** Current index in the model's rows. */
+	int32 Row = INDEX_NONE;
+
+	/** Insertion order; breaks sort ties so equal rows never swap. */
+	uint64 Sequence = 0;
+};
+
+/**
+ * Ordered, optionally filtered and sorted view of a UNeoReplicatedDataComponent for UListView / UTileView.
+ *
+ * Each component notification becomes at most a Move plus an Update, or one Insert or Remove, so a large
+ * inventory costs O(changes) in widget work instead of a rebuild per OnKeyUpdated. BindListView applies the
+ * ops to a list view directly; OnListChanged exposes them for custom views.
+ */
+UCLASS(BlueprintType)
+class NEODATASYNC_API UNeoDataListModel : public UObject
+{
+	GENERATED_BODY()
+
+public:
+	/**
+	 * @param ValueType		Only list entries whose payload is this struct; null lists everything.
+	 * @param SortProperty	Top-level numeric, bool, enum, string, name or text property of ValueType to order rows by.
+	 *						None keeps insertion order.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "NeoData|List")
+	static UNeoDataListModel* CreateListModel(UNeoReplicatedDataComponent* Component, UScriptStruct* ValueType = nullptr,
+		FName SortProperty = NAME_None, bool bSortDescending = false);
+
+	/** Rows in display order, typed for UListView::SetListItems. */
+	UFUNCTION(BlueprintPure, Category = "NeoData|List")
+	TArray<UObject*> GetItems() const;
+
+	UFUNCTION(BlueprintPure, Category = "NeoData|List")
+	int32 Num() const { return Rows.Num(); }
+
+	UFUNCTION(BlueprintPure, Category = "NeoData|List")
+	UNeoDataListItem* GetItem(int32 Index) const { return Rows.IsValidIndex(Index) ? Rows[Index].Get() : nullptr; }
+
+	/** Row index of Key, or INDEX_NONE. */
+	UFUNCTION(BlueprintPure, Category = "NeoData|List")
+	int32 IndexOfKey(const FRecordKey& Key) const;
+
+	/** Keeps ListView in sync: appends and removals are applied item by item; mid-list inserts and moves re-set the list once per frame. */
+	UFUNCTION(BlueprintCallable, Category = "NeoData|List")
+	void BindListView(UListView* ListView);
+
+	/** Ops for each component notification, in order. Indexes refer to the rows after the previous batch. */
+	UPROPERTY(BlueprintAssignable, Category = "NeoData|List")
+	FOnNeoDataListChanged OnListChanged;
+
+	virtual void BeginDestroy() override;
+
+private:
+	void Initialize(UNeoReplicatedDataComponent* InComponent, const UScriptStruct* InValueType, FName InSortProperty, bool bInSortDescending);
+	void Rebuild();
+
+	/** Removes the handlers Initialize bound to Component. */
+	void UnbindComponent();
+
+	UFUNCTION()
+	void HandleKeyAdded(const FRecordKey& Key, const FRecordDefinition& Value);
+
+	UFUNCTION()
+	void HandleKeyUpdated(const FRecordKey& Key, const FRecordDefinition& Value);
+
+	UFUNCTION()
+	void HandleKeyRemoved(const FRecordKey& Key);
+
+	UFUNCTION()
+	void HandleDataReset();
+
+	bool PassesFilter(const FRecordDefinition& Value) const;
+
+	/** Negative if A sorts before B. */
+	int32 CompareRows(const UNeoDataListItem& A, const UNeoDataListItem& B) const;
+
+	/** Index at which Item belongs among Rows (excluding Item itself). */
+	int32 FindInsertIndex(const UNeoDataListItem& Item) const;
+
+	void InsertRow(UNeoDataListItem* Item, int32 Index);
+	void RemoveRow(int32 Index);
+
+	/** Rewrites the Row of Rows[First..Last]. */
+	void ReindexRows(int32 First, int32 Last) const;
+
+	/** Brings the Row of every item up to date before it is read; inserts and removals only mark rows stale. */
+	void ReindexStaleRows() const;
+
+	/** Mirrors one op onto BoundListView. Item is the row inserted, removed or moved. */
+	void SyncListView(ENeoDataListOpType Type, int32 Index, UNeoDataListItem* Item);
+
+	/** Re-sets BoundListView's items if a mid-list change is pending. */
+	void FlushListView();
+
+	UPROPERTY()
+	TWeakObjectPtr<UNeoReplicatedDataComponent> Component;
+
+	UPROPERTY()
+	const UScriptStruct* ValueType = nullptr;
+
+	const FProperty* SortProperty = nullptr;
+	bool bSortDescending = false;
+
+	UPROPERTY()
+	TArray<TObjectPtr<UNeoDataListItem>> Rows;
+
+	/** Listed item of each key; the objects are kept alive by Rows. */
+	TMap<FRecordKey, UNeoDataListItem*> ItemsByKey;
+
+	UPROPERTY()
+	TWeakObjectPtr<UListView> BoundListView;
+
+	/** A FlushListView is scheduled for the next tick. */
+	bool bListViewDirty = false;
+
+	/** First row whose Row may be out of date; INDEX_NONE when all are current. */
+	mutable int32 FirstStaleRow = INDEX_NONE;
+
+	uint64 NextSequence = 0;
+};
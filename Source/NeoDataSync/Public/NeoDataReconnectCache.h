@@ -0,0 +1,51 @@
+// Copyright 2025-2026 NeoNexus Studios. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/GameInstanceSubsystem.h"
+#include "NeoReplicatedData.h"
+
+#include "NeoDataReconnectCache.generated.h"
+
+/** A client's last view of one component's map, kept for its next connection. */
+struct FNeoDataCachedState
+{
+	/** Server map instance the entries came from. See UNeoReplicatedDataComponent::StateEpoch. */
+	FGuid Epoch;
+
+	/** The client holds every entry the server wrote at or below this version, unless it was removed since. */
+	int64 Version = 0;
+
+	TArray<FNeoDataEntry> Items;
+};
+
+/**
+ * Client-side store of map states across disconnects, keyed by component.
+ * Lives as long as the game instance: it survives returning to the menu and reconnecting, not a restart.
+ */
+UCLASS()
+class NEODATASYNC_API UNeoDataReconnectCache : public UGameInstanceSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	static UNeoDataReconnectCache* Get(const UObject* WorldContextObject);
+
+	/** Replaces the state stored under Id. */
+	void Store(const FString& Id, FNeoDataCachedState&& State);
+
+	const FNeoDataCachedState* Find(const FString& Id) const { return States.Find(Id); }
+
+	/** Moves the state stored under Id into OutState and forgets it. */
+	bool Take(const FString& Id, FNeoDataCachedState& OutState);
+
+	/** Forgets every stored state, e.g. when joining a different server. */
+	UFUNCTION(BlueprintCallable, Category = "NeoData|Replication")
+	void ClearCache() { States.Empty(); }
+
+	virtual void Deinitialize() override;
+
+private:
+	TMap<FString, FNeoDataCachedState> States;
+};
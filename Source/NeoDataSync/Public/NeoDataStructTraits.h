@@ -0,0 +1,67 @@
+// Copyright 2025-2026 NeoNexus Studios. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/Class.h"
+
+struct FInstancedStruct;
+
+/**
+ * How values of a struct type are compared.
+ * Resolved once per UScriptStruct so that a comparison is a switch plus one call.
+ */
+enum class ENeoStructCompareMode : uint8
+{
+	/** Tightly packed integral data (no padding, floats, names or pointers): memcmp is exact. */
+	Memcmp,
+	/** The struct provides a native Identical (WithIdentical / WithIdenticalViaEquality). */
+	Native,
+	/** Per-property comparison through UScriptStruct::CompareScriptStruct. */
+	Reflection,
+};
+
+/**
+ * Precomputed equality and hashing for one UScriptStruct.
+ * Used by FRecordKey so key comparisons inside lookups avoid reflection where possible.
+ */
+struct NEODATASYNC_API FNeoStructTraits
+{
+	const UScriptStruct* Struct = nullptr;
+	UScriptStruct::ICppStructOps* CppStructOps = nullptr;
+	int32 Size = 0;
+	ENeoStructCompareMode CompareMode = ENeoStructCompareMode::Reflection;
+
+	/** True if the struct has a native GetTypeHash. */
+	bool bNativeHash = false;
+
+	/**
+	 * True if net serialization of the struct produces the same bits for every connection:
+	 * no object, interface, delegate or nested instanced-struct references, which go through the per-connection package map.
+	 */
+	bool bNetConnectionIndependent = false;
+
+	/** True if values may own heap memory (strings, containers, nested instanced structs). */
+	bool bMayAllocate = true;
+
+	bool Identical(const void* A, const void* B) const;
+
+	/**
+	 * Hash of the value combined with the struct type. Always equal for Identical() values, so it is safe as a pre-check.
+	 * Structs with a native Identical but no native GetTypeHash hash by type only, since their equality may be looser
+	 * than their properties.
+	 */
+	uint32 Hash(const void* Data) const;
+
+	/** Heap memory owned by the value at Data, excluding the struct itself. Objects it references are not counted. */
+	SIZE_T GetAllocatedSize(const void* Data) const;
+
+	/** Heap memory of an instanced struct: its struct allocation plus what the value owns. */
+	static SIZE_T GetAllocatedSize(const FInstancedStruct& Value);
+
+	/** Returns the cached traits for InStruct, resolving them on first use. Thread safe. */
+	static const FNeoStructTraits& Get(const UScriptStruct* InStruct);
+
+private:
+	void Resolve(const UScriptStruct* InStruct);
+};
@@ -0,0 +1,51 @@
+// Copyright 2025-2026 NeoNexus Studios. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Kismet/BlueprintFunctionLibrary.h"
+#include "NeoReplicatedData.h"
+
+#include "NeoDataSyncLibrary.generated.h"
+
+/**
+ * Blueprint helpers for building and reading native record keys.
+ * Native keys skip the instanced-struct wrapper entirely.
+ */
+UCLASS()
+class NEODATASYNC_API UNeoDataSyncLibrary : public UBlueprintFunctionLibrary
+{
+	GENERATED_BODY()
+
+public:
+	UFUNCTION(BlueprintPure, Category = "NeoData|Key", meta = (DisplayName = "Make Name Key"))
+	static FRecordKey MakeNameKey(FName Name);
+
+	UFUNCTION(BlueprintPure, Category = "NeoData|Key", meta = (DisplayName = "Make Int Key"))
+	static FRecordKey MakeIntKey(int64 Value);
+
+	UFUNCTION(BlueprintPure, Category = "NeoData|Key", meta = (DisplayName = "Make Guid Key"))
+	static FRecordKey MakeGuidKey(const FGuid& Guid);
+
+	UFUNCTION(BlueprintPure, Category = "NeoData|Key", meta = (DisplayName = "Make Gameplay Tag Key"))
+	static FRecordKey MakeGameplayTagKey(FGameplayTag Tag);
+
+	/** @return true if Key is a Name key. */
+	UFUNCTION(BlueprintPure, Category = "NeoData|Key")
+	static bool GetNameFromKey(const FRecordKey& Key, FName& OutName);
+
+	/** @return true if Key is an Int key. */
+	UFUNCTION(BlueprintPure, Category = "NeoData|Key")
+	static bool GetIntFromKey(const FRecordKey& Key, int64& OutValue);
+
+	/** @return true if Key is a Guid key. */
+	UFUNCTION(BlueprintPure, Category = "NeoData|Key")
+	static bool GetGuidFromKey(const FRecordKey& Key, FGuid& OutGuid);
+
+	/** @return true if Key is a Gameplay Tag key. */
+	UFUNCTION(BlueprintPure, Category = "NeoData|Key")
+	static bool GetGameplayTagFromKey(const FRecordKey& Key, FGameplayTag& OutTag);
+
+	UFUNCTION(BlueprintPure, Category = "NeoData|Key", meta = (DisplayName = "To String (RecordKey)", CompactNodeTitle = "->", BlueprintAutocast))
+	static FString Conv_RecordKeyToString(const FRecordKey& Key);
+};
@@ -0,0 +1,67 @@
+// Copyright 2025-2026 NeoNexus Studios. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "NeoReplicatedData.h"
+
+/** A key scheduled to expire at ExpireTime (world seconds). */
+struct FNeoExpiryTimer
+{
+	FRecordKey Key;
+	double ExpireTime = 0.0;
+};
+
+/**
+ * Hierarchical timing wheel for entry expiry.
+ *
+ * Four levels of 64 slots; level 0 slots are Resolution seconds wide, each higher level is 64x coarser
+ * (0.1s resolution covers ~6.4s, ~7min, ~7.5h and ~19 days). Scheduling is O(1). Advancing is O(expired) plus
+ * at most one cascade per timer per level, independent of how many timers are pending.
+ *
+ * Timers are never cancelled: callers compare the popped ExpireTime with the entry's current one and ignore stale timers.
+ */
+class NEODATASYNC_API FNeoExpiryWheel
+{
+public:
+	explicit FNeoExpiryWheel(double InResolution = 0.1, double StartTime = 0.0);
+
+	/** Schedules Key to expire at ExpireTime. Times in the past expire on the next Advance. */
+	void Schedule(const FRecordKey& Key, double ExpireTime);
+
+	/** Moves the wheel to Now and appends every timer due by then to OutExpired. */
+	void Advance(double Now, TArray<FNeoExpiryTimer>& OutExpired);
+
+	/** Timers still in the wheel, including stale ones not yet popped. */
+	int32 Num() const { return NumTimers; }
+
+	double GetResolution() const { return Resolution; }
+
+private:
+	static constexpr int32 SlotBits = 6;
+	static constexpr int32 SlotsPerLevel = 1 << SlotBits;
+	static constexpr int32 SlotMask = SlotsPerLevel - 1;
+	static constexpr int32 NumLevels = 4;
+
+	uint64 ToTick(double Time) const;
+	void Insert(FNeoExpiryTimer&& Timer, uint64 ExpireTick);
+
+	/** Re-inserts every timer of Level's slot at SlotIndex into lower levels. Returns SlotIndex. */
+	int32 Cascade(int32 Level, int32 SlotIndex);
+
+	double Resolution;
+
+	/** Next tick to process. Every timer with ExpireTick < CurrentTick has been popped. */
+	uint64 CurrentTick;
+
+	int32 NumTimers = 0;
+
+	/** Timers with their absolute expire tick, so cascades can place them without re-reading the time. */
+	struct FSlotTimer
+	{
+		FNeoExpiryTimer Timer;
+		uint64 ExpireTick = 0;
+	};
+
+	TArray<FSlotTimer> Slots[NumLevels][SlotsPerLevel];
+};
@@ -7,16 +7,45 @@
 #include "Net/Serialization/FastArraySerializer.h"
 #include "InstancedStruct.h"
 #include "StructUtils/InstancedStruct.h"
+#include "GameplayTagContainer.h"
+#include "Containers/HashTable.h"
+#include "UObject/ObjectKey.h"
+#include "HAL/LowLevelMemTracker.h"
+#include "NeoDataStructTraits.h"
 
 #include "NeoReplicatedData.generated.h"
 
+/** LLM tag for map storage, payloads and caches of the plugin. */
+LLM_DECLARE_TAG_API(NeoDataSync, NEODATASYNC_API);
+
 struct FNeoDataMap;
 class UNeoReplicatedDataComponent;
+class FNeoExpiryWheel;
+class FNeoDataHistory;
+class FNeoDataChangeStream;
+class FNeoDataDigest;
+class FNeoDataReconnect;
+class UNeoDataDefaultsAsset;
+class UNetConnection;
+
+/** Storage used by an FRecordKey. Native kinds are stored inline and compared/hashed without reflection. */
+UENUM(BlueprintType)
+enum class ENeoRecordKeyKind : uint8
+{
+	/** Arbitrary USTRUCT held in KeyData. */
+	Struct,
+	Name,
+	Int,
+	Guid,
+	GameplayTag,
+	/** Internal: transaction manifest entry, IntKey is the transaction id. Never returned to callers. */
+	Transaction UMETA(Hidden),
+};
 
 /**
  * Unique Identifier for a Record.
  * Acts as the Key in the Replicated Map.
- * Now supports any Struct via FInstancedStruct.
+ * Supports any Struct via FInstancedStruct, plus inline FName, int64, FGuid and FGameplayTag keys.
  */
 USTRUCT(BlueprintType)
 struct NEODATASYNC_API FRecordKey
@@ -24,34 +53,139 @@ struct NEODATASYNC_API FRecordKey
 	GENERATED_BODY()
 
 	FRecordKey() {}
-	FRecordKey(const FInstancedStruct& InKeyData) : KeyData(InKeyData) {}
 
+	/** FGuid and FGameplayTag payloads are folded into their inline kinds. */
+	FRecordKey(const FInstancedStruct& InKeyData);
+
+	explicit FRecordKey(FName InName) : Kind(ENeoRecordKeyKind::Name), NameKey(InName) {}
+	explicit FRecordKey(int64 InInt) : Kind(ENeoRecordKeyKind::Int), IntKey(InInt) {}
+	explicit FRecordKey(const FGuid& InGuid) : Kind(ENeoRecordKeyKind::Guid), GuidKey(InGuid) {}
+	explicit FRecordKey(const FGameplayTag& InTag) : Kind(ENeoRecordKeyKind::GameplayTag), TagKey(InTag) {}
+
+	/** Key of the manifest entry for a transaction. */
+	static FRecordKey MakeTransaction(int32 TransactionId)
+	{
+		FRecordKey Key;
+		Key.Kind = ENeoRecordKeyKind::Transaction;
+		Key.IntKey = TransactionId;
+		return Key;
+	}
+
+	/**
+	 * Wraps any supported key type: FName, integers/enums, FGuid, FGameplayTag or a USTRUCT.
+	 * Usage: FRecordKey::Make(FName("HeroStats"))
+	 */
+	template <typename KeyT>
+	static FRecordKey Make(const KeyT& InKey)
+	{
+		if constexpr (std::is_same_v<KeyT, FName> || std::is_same_v<KeyT, FGuid> || std::is_same_v<KeyT, FGameplayTag>)
+		{
+			return FRecordKey(InKey);
+		}
+		else if constexpr (std::is_integral_v<KeyT> || std::is_enum_v<KeyT>)
+		{
+			return FRecordKey(static_cast<int64>(InKey));
+		}
+		else
+		{
+			static_assert(TModels<CStaticStructProvider, KeyT>::Value, "KeyT must be FName, an integer, FGuid, FGameplayTag or a USTRUCT");
+			return FRecordKey(FInstancedStruct::Make(InKey));
+		}
+	}
+
+	/** Used when Kind is Struct. Blueprint keys built with Make RecordKey arrive here; see Normalize. */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Data Sync")
 	FInstancedStruct KeyData;
 
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Data Sync")
+	ENeoRecordKeyKind Kind = ENeoRecordKeyKind::Struct;
+
+	UPROPERTY()
+	FName NameKey;
+
+	UPROPERTY()
+	int64 IntKey = 0;
+
+	UPROPERTY()
+	FGuid GuidKey;
+
+	UPROPERTY()
+	FGameplayTag TagKey;
+
+	bool IsValid() const { return Kind != ENeoRecordKeyKind::Struct || KeyData.IsValid(); }
+
+	bool IsTransaction() const { return Kind == ENeoRecordKeyKind::Transaction; }
+
+	/**
+	 * Returns this key in canonical form: a Struct key holding an FGuid or FGameplayTag becomes the inline kind.
+	 * Returns *this when already canonical, otherwise fills and returns Scratch.
+	 */
+	const FRecordKey& Normalize(FRecordKey& Scratch) const;
+
+	/** Human readable form for logs and debugging. */
+	FString ToString() const;
+
+	bool NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess);
+
 	bool operator==(const FRecordKey& Other) const
 	{
-		// FInstancedStruct::operator== checks type and binary equality
-		return KeyData == Other.KeyData;
+		if (Kind != Other.Kind)
+		{
+			return false;
+		}
+
+		switch (Kind)
+		{
+		case ENeoRecordKeyKind::Name:			return NameKey == Other.NameKey;
+		case ENeoRecordKeyKind::Int:			return IntKey == Other.IntKey;
+		case ENeoRecordKeyKind::Guid:			return GuidKey == Other.GuidKey;
+		case ENeoRecordKeyKind::GameplayTag:	return TagKey == Other.TagKey;
+		case ENeoRecordKeyKind::Transaction:	return IntKey == Other.IntKey;
+		default:								break;
+		}
+
+		const UScriptStruct* ScriptStruct = KeyData.GetScriptStruct();
+		if (ScriptStruct != Other.KeyData.GetScriptStruct())
+		{
+			return false;
+		}
+
+		// Per-type equality resolved once: native Identical, memcmp for packed integral structs, or reflection
+		return !ScriptStruct || FNeoStructTraits::Get(ScriptStruct).Identical(KeyData.GetMemory(), Other.KeyData.GetMemory());
 	}
 
 	friend uint32 GetTypeHash(const FRecordKey& Key)
 	{
-		if (Key.KeyData.IsValid())
+		switch (Key.Kind)
+		{
+		case ENeoRecordKeyKind::Name:			return HashCombine(1, GetTypeHash(Key.NameKey));
+		case ENeoRecordKeyKind::Int:			return HashCombine(2, GetTypeHash(Key.IntKey));
+		case ENeoRecordKeyKind::Guid:			return HashCombine(3, GetTypeHash(Key.GuidKey));
+		case ENeoRecordKeyKind::GameplayTag:	return HashCombine(4, GetTypeHash(Key.TagKey));
+		case ENeoRecordKeyKind::Transaction:	return HashCombine(5, GetTypeHash(Key.IntKey));
+		default:								break;
+		}
+
+		if (const UScriptStruct* ScriptStruct = Key.KeyData.GetScriptStruct())
 		{
-			// WARNING: MemCrc32 includes padding! Structs must be FMemory::Memzero'd before use.
-			// Preferred: Use the struct's own hash function if available, or hash properties.
-			const UScriptStruct* ScriptStruct = Key.KeyData.GetScriptStruct();
-			
-			// Note: This still risks padding issues but is the only generic options without reflection iteration.
-			// Ideally: return ScriptStruct->GetStructTypeHash(Key.KeyData.GetMemory());
-			return FCrc::MemCrc32(Key.KeyData.GetMemory(), ScriptStruct->GetStructureSize());
+			// Consistent with operator==: native hash, CRC of padding-free memory, or per-property hash
+			return FNeoStructTraits::Get(ScriptStruct).Hash(Key.KeyData.GetMemory());
 		}
 		
 		return 0;
 	}
 };
 
+template<>
+struct TStructOpsTypeTraits<FRecordKey> : TStructOpsTypeTraitsBase2<FRecordKey>
+{
+	enum
+	{
+		WithNetSerializer = true,
+		WithIdenticalViaEquality = true,
+	};
+};
+
 /**
  * Container for the Record Data.
  * Holds an arbitrary struct (Payload) that defines the record's schema.
@@ -105,6 +239,62 @@ struct NEODATASYNC_API FNeoDataDefinition_SIF
 	}
 };
 
+template<>
+struct TStructOpsTypeTraits<FNeoDataDefinition_SI> : TStructOpsTypeTraitsBase2<FNeoDataDefinition_SI>
+{
+	enum
+	{
+		WithIdenticalViaEquality = true,
+	};
+};
+
+template<>
+struct TStructOpsTypeTraits<FNeoDataDefinition_SIF> : TStructOpsTypeTraitsBase2<FNeoDataDefinition_SIF>
+{
+	enum
+	{
+		WithIdenticalViaEquality = true,
+	};
+};
+
+/** Per-entry behaviour flags, stored in FNeoDataEntry::Flags. */
+enum class ENeoDataEntryFlags : uint8
+{
+	None		= 0,
+	/** Value updates travel through the component's unreliable latest-value channel instead of the fast array. */
+	Volatile	= 1 << 0,
+	/** Value is content-addressed by StaticHash: the owning client gets only the hash and fills the value from its disk cache. */
+	Static		= 1 << 1,
+	/** Local copy of a baked default (UNeoDataDefaultsAsset), held on server and clients and never replicated. Any changing write clears it. */
+	Default		= 1 << 2,
+};
+ENUM_CLASS_FLAGS(ENeoDataEntryFlags)
+
+/**
+ * Generational reference to one map entry, from FindHandle or SetTypedDataWithHandle.
+ * Resolves in O(1) without wrapping or hashing the key, and stops resolving once the entry is removed,
+ * even if the key is added again later. Only valid with the component that issued it.
+ */
+USTRUCT(BlueprintType)
+struct NEODATASYNC_API FNeoDataHandle
+{
+	GENERATED_BODY()
+
+	FNeoDataHandle() {}
+	FNeoDataHandle(int32 InSlot, int32 InGeneration) : Slot(InSlot), Generation(InGeneration) {}
+
+	UPROPERTY()
+	int32 Slot = INDEX_NONE;
+
+	UPROPERTY()
+	int32 Generation = 0;
+
+	bool IsSet() const { return Slot != INDEX_NONE; }
+
+	bool operator==(const FNeoDataHandle& Other) const { return Slot == Other.Slot && Generation == Other.Generation; }
+	bool operator!=(const FNeoDataHandle& Other) const { return !(*this == Other); }
+};
+
 /**
  * A single entry in the replicated map.
  */
@@ -123,6 +313,59 @@ struct NEODATASYNC_API FNeoDataEntry : public FFastArraySerializerItem
 	UPROPERTY()
 	FRecordDefinition Value;
 
+	/** ENeoDataEntryFlags */
+	UPROPERTY()
+	uint8 Flags = 0;
+
+	/** Incremented on each volatile write; clients drop unreliable updates older than what they hold. */
+	UPROPERTY()
+	uint32 VolatileSequence = 0;
+
+	/** Server world time (AGameStateBase::GetServerWorldTimeSeconds) at which the entry is removed; 0 = never. */
+	UPROPERTY()
+	double ExpireTime = 0.0;
+
+	/**
+	 * Map-wide write counter at the entry's last change. Strictly increases on every write, including volatile ones,
+	 * and never repeats for a key across remove and re-add. See UNeoReplicatedDataComponent::CompareAndSet.
+	 */
+	UPROPERTY()
+	int64 Version = 0;
+
+	/** Transaction that last wrote the entry, or 0. Clients hold its notifications until the whole transaction has arrived. */
+	UPROPERTY()
+	int32 TransactionId = 0;
+
+	/** Content hash of the value while the entry is Static. See UNeoReplicatedDataComponent::SetStaticData. */
+	UPROPERTY()
+	uint64 StaticHash = 0;
+
+	/** Slot in the owning map's handle table once a handle was issued for the entry. Local, never replicated. */
+	mutable int32 HandleSlot = INDEX_NONE;
+
+	/** The entry's current contribution to the owning map's state digest (0 = not counted) and its key hash. Local. */
+	mutable uint64 DigestValue = 0;
+	mutable uint32 DigestKeyHash = 0;
+
+	/**
+	 * Client: arrived as a static hash missing from the disk cache; the value is requested and notifications wait for it.
+	 * Until then Value keeps the previous value, or is empty for a new key, and the write has not arrived for its transaction.
+	 */
+	mutable bool bAwaitingStatic = false;
+	mutable bool bStaticAddPending = false;
+
+	bool HasFlags(ENeoDataEntryFlags InFlags) const { return EnumHasAllFlags(static_cast<ENeoDataEntryFlags>(Flags), InFlags); }
+	void SetFlags(ENeoDataEntryFlags InFlags, bool bEnabled)
+	{
+		Flags = bEnabled ? (Flags | static_cast<uint8>(InFlags)) : (Flags & ~static_cast<uint8>(InFlags));
+	}
+
+	/**
+	 * Custom wire format so the payload body can be encoded once per net update and shared by all connections.
+	 * See FNeoDataMap::NetDeltaSerialize.
+	 */
+	bool NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess);
+
 	// Hooks for FastArraySerializer
 	void PreReplicatedRemove(const FNeoDataMap& InArraySerializer) const;
 	void PostReplicatedAdd(const FNeoDataMap& InArraySerializer) const;
@@ -134,161 +377,1469 @@ struct NEODATASYNC_API FNeoDataEntry : public FFastArraySerializerItem
 	}
 };
 
+template<>
+struct TStructOpsTypeTraits<FNeoDataEntry> : TStructOpsTypeTraitsBase2<FNeoDataEntry>
+{
+	enum
+	{
+		WithNetSerializer = true,
+	};
+};
+
 /**
- * The Fast Array Serializer wrapper that behaves like a Map.
+ * Payload body bits of one entry revision, encoded once and reused by every connection in the same net update.
+ * Only used for payload types whose encoding does not depend on the connection (FNeoStructTraits::bNetConnectionIndependent).
  */
-USTRUCT(BlueprintType)
-struct NEODATASYNC_API FNeoDataMap : public FFastArraySerializer
+struct FNeoSharedPayloadBits
 {
-	GENERATED_BODY()
+	TArray<uint8> Data;
+	int64 NumBits = 0;
 
-	FNeoDataMap() : Owner(nullptr) {}
+	// Revision the bits were encoded from
+	int32 ReplicationKey = INDEX_NONE;
+	uint32 VolatileSequence = 0;
+	uint32 EngineNetVer = 0;
+	uint32 GameNetVer = 0;
+};
+
+/**
+ * One latest-value update sent through the unreliable volatile channel.
+ */
+USTRUCT()
+struct NEODATASYNC_API FNeoVolatileUpdate
+{
+	GENERATED_BODY()
 
 	UPROPERTY()
-	TArray<FNeoDataEntry> Items;
+	FRecordKey Key;
 
-	// Owner back-reference for delegate broadcasting
-	UPROPERTY(NotReplicated)
-	TObjectPtr<UNeoReplicatedDataComponent> Owner;
+	UPROPERTY()
+	FRecordDefinition Value;
 
-	bool NetDeltaSerialize(FNetDeltaSerializeInfo& DeltaParms)
-	{
-		return FastArrayDeltaSerialize<FNeoDataEntry, FNeoDataMap>(Items, DeltaParms, *this);
-	}
+	UPROPERTY()
+	uint32 Sequence = 0;
 
-	void AddOrUpdate(const FRecordKey& Key, const FRecordDefinition& Value);
-	void Remove(const FRecordKey& Key);
-	const FRecordDefinition* Find(const FRecordKey& Key) const;
-	FRecordDefinition* Find(const FRecordKey& Key);
+	UPROPERTY()
+	int64 Version = 0;
 };
 
 /**
- * Trait to enable FastArraySerializer behavior
+ * Server's answer to one round of a state digest comparison. See UNeoReplicatedDataComponent::VerifyStateDigest.
  */
-template<>
-struct TStructOpsTypeTraits<FNeoDataMap> : TStructOpsTypeTraitsBase2<FNeoDataMap>
+USTRUCT()
+struct NEODATASYNC_API FNeoDataDigestResponse
 {
-	enum
-	{
-		WithNetDeltaSerializer = true,
-	};
+	GENERATED_BODY()
+
+	/** Children of the mismatched inner nodes, with the server's hashes, for the client to compare next. */
+	UPROPERTY()
+	TArray<int32> Nodes;
+
+	UPROPERTY()
+	TArray<uint64> Hashes;
+
+	/** Mismatched leaf buckets. Their server entries are re-sent through the fast array. */
+	UPROPERTY()
+	TArray<int32> Buckets;
+
+	/** FNeoDataDigest::HashKey of every server entry in Buckets; client entries there with other keys are stale. */
+	UPROPERTY()
+	TArray<uint32> KeyHashes;
+
+	/** The server declined the request: this connection sent more than NeoData.DigestMaxRequests recently. */
+	UPROPERTY()
+	bool bThrottled = false;
 };
 
-// Delegates
-DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnNeoDataKeyChanged, const FRecordKey&, Key, const FRecordDefinition&, Value);
-DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnNeoDataKeyRemoved, const FRecordKey&, Key);
+/**
+ * Payload of a transaction's manifest entry. Written last in the commit, so it replicates with the
+ * transaction's entries; clients use it to tell when every write and removal of the group has been applied.
+ */
+USTRUCT()
+struct NEODATASYNC_API FNeoDataTransactionManifest
+{
+	GENERATED_BODY()
+
+	/**
+	 * Keys written by the transaction; their entries carry its TransactionId. The server drops a key here when a
+	 * later write or removal supersedes it, so clients never wait for a write they will not receive.
+	 */
+	UPROPERTY()
+	TArray<FRecordKey> WrittenKeys;
+
+	/** Keys the transaction removed that existed before it began. */
+	UPROPERTY()
+	TArray<FRecordKey> RemovedKeys;
+};
 
 /**
- * The Component container.
+ * Local write counters for a single FNeoDataMap.
+ * Not replicated; server and clients each count their own mutations.
  */
-UCLASS(BlueprintType, Blueprintable, ClassGroup=(Custom), meta=(BlueprintSpawnableComponent))
-class NEODATASYNC_API UNeoReplicatedDataComponent : public UActorComponent
+USTRUCT(BlueprintType)
+struct NEODATASYNC_API FNeoDataMapStats
 {
 	GENERATED_BODY()
 
-public:
-	UNeoReplicatedDataComponent();
+	/** AddOrUpdate calls that added a key or changed its value. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Data Sync")
+	int64 AppliedWrites = 0;
 
-	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
+	/** AddOrUpdate calls skipped because the new value was identical to the stored one. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Data Sync")
+	int64 SuppressedWrites = 0;
 
-	// The Map
-	UPROPERTY(Replicated)
-	FNeoDataMap DataMap;
+	/** Volatile writes that changed a value without dirtying the fast array. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Data Sync")
+	int64 VolatileWrites = 0;
 
-	// -------------------------------------------------------------------------
-	// Schema Enforcement
-	// -------------------------------------------------------------------------
-	
-	/** 
-	 * Optional: Restrict Keys to this specific Struct type. 
-	 * If set, SetData will ignore keys of other types.
-	 */
-	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "NeoData|Schema")
-	const UScriptStruct* RestrictedKeyType;
+	/** Volatile updates actually sent unreliably (several writes to a key within a tick coalesce into one). */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Data Sync")
+	int64 VolatileUpdatesSent = 0;
 
-	/** 
-	 * Optional: Restrict Values to this specific Struct type. 
-	 * If set, SetData will ignore values of other types.
-	 */
-	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "NeoData|Schema")
-	const UScriptStruct* RestrictedValueType;
+	/** Unreliable multicast batches sent. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Data Sync")
+	int64 VolatileBatchesSent = 0;
 
-	// -------------------------------------------------------------------------
-	// Blueprint API
-	// -------------------------------------------------------------------------
+	/** Reliable fast-array re-sends of volatile keys once they stopped changing. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Data Sync")
+	int64 VolatileSettles = 0;
 
-	UFUNCTION(BlueprintCallable, BlueprintAuthorityOnly, Category = "NeoData")
-	void SetData(const FRecordKey& Key, const FRecordDefinition& Value);
+	/** Payload encodings reused from another connection in the same net update. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Data Sync")
+	int64 SharedPayloadHits = 0;
 
-	UFUNCTION(BlueprintCallable, BlueprintAuthorityOnly, Category = "NeoData")
-	void RemoveData(const FRecordKey& Key);
+	/** Payload encodings produced and cached for other connections. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Data Sync")
+	int64 SharedPayloadMisses = 0;
 
-	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "NeoData")
-	bool GetData(const FRecordKey& Key, FRecordDefinition& OutValue) const;
-	
-	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "NeoData")
-	TArray<FRecordKey> GetKeys() const;
+	/** CompareAndSet calls rejected because the entry had moved past the expected version. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Data Sync")
+	int64 CompareAndSetFailures = 0;
 
-	// -------------------------------------------------------------------------
-	// C++ Templated API
-	// -------------------------------------------------------------------------
+	/** Entries removed by their TTL. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Data Sync")
+	int64 ExpiredEntries = 0;
 
-	/**
-	 * Strongly typed Set for C++.
-	 * Automatically wraps structs in FRecordKey/FRecordDefinition.
-	 * Usage: MyComponent->SetTypedData(MyKeyStruct, MyValueStruct);
-	 */
-	template <typename KeyT, typename ValueT>
-	void SetTypedData(const KeyT& InKey, const ValueT& InValue)
-	{
-		// Static checks to ensure we are passing valid UStructs
-		static_assert(TModels<CStaticStructProvider, KeyT>::Value, "KeyT must be a USTRUCT");
-		static_assert(TModels<CStaticStructProvider, ValueT>::Value, "ValueT must be a USTRUCT");
+	/** Replay checkpoints that included this map, and the bytes it wrote into them. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Data Sync")
+	int64 ReplayCheckpoints = 0;
 
-		FRecordKey WrappedKey(FInstancedStruct::Make(InKey));
-		FRecordDefinition WrappedValue(FInstancedStruct::Make(InValue));
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Data Sync")
+	int64 ReplayCheckpointBytes = 0;
 
-		SetData(WrappedKey, WrappedValue);
-	}
+	/** Checkpoints written as a delta against the previous one (demo.DeltaCheckpoints); included in ReplayCheckpoints. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Data Sync")
+	int64 ReplayDeltaCheckpoints = 0;
 
-	/**
-	 * Strongly typed Get for C++.
-	 * Usage: 
-	 *    FMyValue Val;
-	 *    if (MyComponent->GetTypedData(MyKey, Val)) { ... }
-	 */
-	template <typename KeyT, typename ValueT>
-	bool GetTypedData(const KeyT& InKey, ValueT& OutValue) const
-	{
-		static_assert(TModels<CStaticStructProvider, KeyT>::Value, "KeyT must be a USTRUCT");
-		static_assert(TModels<CStaticStructProvider, ValueT>::Value, "ValueT must be a USTRUCT");
+	/** Replay scrubs applied to this map, and the time spent deserializing them. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Data Sync")
+	int64 ReplayScrubs = 0;
 
-		FRecordKey WrappedKey(FInstancedStruct::Make(InKey));
-		FRecordDefinition OutDef;
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Data Sync")
+	int64 ReplayScrubMicroseconds = 0;
 
-		if (GetData(WrappedKey, OutDef))
-		{
-			if (const ValueT* Ptr = OutDef.Payload.GetPtr<ValueT>())
-			{
-				OutValue = *Ptr;
-				return true;
-			}
-		}
-		return false;
-	}
+	/** Storage compactions after churn, and the bytes of item, key hash and index capacity they released. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Data Sync")
+	int64 Compactions = 0;
 
-	// Delegates
-	UPROPERTY(BlueprintAssignable, Category = "NeoData")
-	FOnNeoDataKeyChanged OnKeyAdded;
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Data Sync")
+	int64 CompactionReclaimedBytes = 0;
 
-	UPROPERTY(BlueprintAssignable, Category = "NeoData")
-	FOnNeoDataKeyChanged OnKeyUpdated;
+	/** State digest checks started (client) and buckets found divergent in them. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Data Sync")
+	int64 DigestChecks = 0;
 
-	UPROPERTY(BlueprintAssignable, Category = "NeoData")
-	FOnNeoDataKeyRemoved OnKeyRemoved;
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Data Sync")
+	int64 DigestDivergentBuckets = 0;
 
-	// Internal hook for the struct to call back
-	void NotifyKeyAdded(const FRecordKey& Key, const FRecordDefinition& Value) const;
-	void NotifyKeyUpdated(const FRecordKey& Key, const FRecordDefinition& Value) const;
-	void NotifyKeyRemoved(const FRecordKey& Key) const;
-};
\ No newline at end of file
+	/** Entries of divergent buckets re-sent (server) and stale entries dropped because the server lacks them (client). */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Data Sync")
+	int64 DigestResentEntries = 0;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Data Sync")
+	int64 DigestStaleEntries = 0;
+
+	/** Digest requests declined because their connection exceeded NeoData.DigestMaxRequests (server). */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Data Sync")
+	int64 DigestThrottledRequests = 0;
+
+	/** Reconnects resynced from the client's cache, and reported caches the server could not use (server). */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Data Sync")
+	int64 ReconnectResyncs = 0;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Data Sync")
+	int64 ReconnectFullResyncs = 0;
+
+	/** Entries not re-sent because the reconnecting client had them (server), and entries restored from the cache (client). */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Data Sync")
+	int64 ReconnectSkippedEntries = 0;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Data Sync")
+	int64 ReconnectRestoredEntries = 0;
+
+	/** Static entries sent as a hash only, and values sent on request (server). */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Data Sync")
+	int64 StaticStubsSent = 0;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Data Sync")
+	int64 StaticEntriesServed = 0;
+
+	/** Static entries filled from the disk cache, and values fetched from the server (client). */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Data Sync")
+	int64 StaticCacheHits = 0;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Data Sync")
+	int64 StaticEntriesFetched = 0;
+
+	/** Fetched values that did not match their hash; applied for the session but kept out of the disk cache (client). */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Data Sync")
+	int64 StaticHashMismatches = 0;
+
+	/** Fast array bytes sent and received by this map; compare joins with a cold and a warm static cache. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Data Sync")
+	int64 BytesSent = 0;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Data Sync")
+	int64 BytesReceived = 0;
+
+	/** Entries loaded from DefaultsAsset instead of replicated. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Data Sync")
+	int64 DefaultEntries = 0;
+
+	/** Defaults overwritten with a different value, which then replicate, and overrides written back to their default (server). */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Data Sync")
+	int64 DefaultOverrides = 0;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Data Sync")
+	int64 DefaultReverts = 0;
+};
+
+/** One static value sent to a client that did not have it cached. */
+USTRUCT()
+struct NEODATASYNC_API FNeoDataStaticPayload
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	uint64 Hash = 0;
+
+	UPROPERTY()
+	FRecordDefinition Value;
+};
+
+/** Entry filter for one send of a map to a connection that is resyncing after a reconnect. */
+struct FNeoDataResyncFilter
+{
+	/** Send nothing: the client has not reported its cache yet. */
+	bool bWithholdAll = false;
+
+	/** Entries at or below this version are in the client's cache and are skipped, unless volatile. */
+	int64 ClientVersion = 0;
+
+	/** ReplicationID and ReplicationKey of the skipped entries, recorded into the connection's base state as sent. */
+	TArray<TPair<int32, int32>> Skipped;
+};
+
+/**
+ * Fast array base state of one connection, stamped with the map version it holds: the client has every entry
+ * written at or below Version once it has applied the sends that led to this state. Only stamped when
+ * bEnableReconnectResync is set, and never for replays.
+ */
+struct FNeoDataBaseState : public FNetFastTArrayBaseState
+{
+	int64 Version = 0;
+};
+
+/** Server: state digest requests of one client connection, and the divergent entries to re-send to it. */
+struct FNeoDataDigestRepair
+{
+	/** Start of the current rate limit window and the requests received in it. */
+	double WindowStart = 0.0;
+	int32 Requests = 0;
+
+	/** ReplicationIDs re-sent on the next send to this connection only. */
+	TSet<int32> ResendIDs;
+};
+
+/** Memory held by the keys and values of one struct type in a map. */
+USTRUCT(BlueprintType)
+struct NEODATASYNC_API FNeoDataTypeMemory
+{
+	GENERATED_BODY()
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Data Sync")
+	const UScriptStruct* Struct = nullptr;
+
+	/** Struct keys and values of this type. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Data Sync")
+	int32 NumKeys = 0;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Data Sync")
+	int32 NumValues = 0;
+
+	/** Heap bytes: struct allocations plus the strings, containers and nested structs they own. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Data Sync")
+	int64 KeyBytes = 0;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Data Sync")
+	int64 ValueBytes = 0;
+};
+
+/** Heap memory of a map, split by what holds it. */
+USTRUCT(BlueprintType)
+struct NEODATASYNC_API FNeoDataMemoryUsage
+{
+	GENERATED_BODY()
+
+	/** Items array allocation, including slack. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Data Sync")
+	int64 ItemsBytes = 0;
+
+	/** Key and value payload allocations; Types breaks these down. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Data Sync")
+	int64 PayloadBytes = 0;
+
+	/** Key hashes and the hash index. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Data Sync")
+	int64 IndexBytes = 0;
+
+	/** Shared payload encodings, history and other per-component caches. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Data Sync")
+	int64 CacheBytes = 0;
+
+	/** Per struct type, largest first. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Data Sync")
+	TArray<FNeoDataTypeMemory> Types;
+
+	int64 GetTotalBytes() const { return ItemsBytes + PayloadBytes + IndexBytes + CacheBytes; }
+};
+
+/** Handle table slot: where the entry currently sits, and the generation its live handles carry. */
+struct FNeoDataHandleSlot
+{
+	/** Re-finds the entry when replication moved it. */
+	FRecordKey Key;
+	int32 ItemIndex = INDEX_NONE;
+	int32 Generation = 1;
+};
+
+/** Client: what readers see of a key while an incomplete transaction holds back its new value or its removal. */
+struct FNeoDataTransactionShadow
+{
+	/** The value before the transaction; unset if the key did not exist. */
+	TOptional<FRecordDefinition> Value;
+	int64 Version = 0;
+
+	/** Transaction holding the key back; 0 for a removal of the current receive not yet matched to one. */
+	int32 TransactionId = 0;
+
+	/** The entry already left Items; HandleSlot keeps serving its handles. */
+	bool bRemoved = false;
+	int32 HandleSlot = INDEX_NONE;
+};
+
+/**
+ * The Fast Array Serializer wrapper that behaves like a Map.
+ */
+USTRUCT(BlueprintType)
+struct NEODATASYNC_API FNeoDataMap : public FFastArraySerializer
+{
+	GENERATED_BODY()
+
+	FNeoDataMap() : Owner(nullptr) {}
+
+	UPROPERTY()
+	TArray<FNeoDataEntry> Items;
+
+	// Owner back-reference for delegate broadcasting
+	UPROPERTY(NotReplicated)
+	TObjectPtr<UNeoReplicatedDataComponent> Owner;
+
+	// Local write counters (not replicated)
+	FNeoDataMapStats Stats;
+
+	/** State digest kept up to date with Items, or null. Owned by the component. */
+	FNeoDataDigest* Digest = nullptr;
+
+	/** Server: removal log and resync state for reconnecting clients, or null. Owned by the component. */
+	FNeoDataReconnect* Reconnect = nullptr;
+
+	/** Baked default values by normalized key, or null. Owned by the component. */
+	const TMap<FRecordKey, FRecordDefinition>* Defaults = nullptr;
+
+	/**
+	 * Fast array hook, called per entry while writing. Applies the resync filter of the connection being sent to.
+	 */
+	template<typename Type, typename SerializerType>
+	bool ShouldWriteFastArrayItem(const Type& Item, const bool bIsWritingOnClient)
+	{
+		// Every connection has the defaults already
+		if (Item.HasFlags(ENeoDataEntryFlags::Default))
+		{
+			return false;
+		}
+
+		if (bIsWritingOnClient || !ResyncFilter)
+		{
+			return FFastArraySerializer::ShouldWriteFastArrayItem<Type, SerializerType>(Item, bIsWritingOnClient);
+		}
+
+		if (ResyncFilter->bWithholdAll)
+		{
+			return false;
+		}
+
+		// Volatile values may have been cached from a dropped unreliable update
+		if (Item.Version > ResyncFilter->ClientVersion || Item.HasFlags(ENeoDataEntryFlags::Volatile))
+		{
+			return true;
+		}
+
+		ResyncFilter->Skipped.Emplace(Item.ReplicationID, Item.ReplicationKey);
+		return false;
+	}
+
+	bool NetDeltaSerialize(FNetDeltaSerializeInfo& DeltaParms);
+
+	/** The map whose NetDeltaSerialize is running on this thread, or nullptr. Lets entries reach the shared payload cache. */
+	static FNeoDataMap* GetSerializingMap();
+
+	/**
+	 * Adds the key or updates its value.
+	 * Writing a value identical to the stored one is a no-op (no dirty mark, no notify) unless the owner disables it.
+	 * Volatile updates of an existing volatile entry change the value locally without dirtying the fast array;
+	 * the owner is responsible for sending them.
+	 * @param OutHandle	If set, receives a handle to Key's entry, taken before any listener runs.
+	 * @return true if the map changed.
+	 */
+	bool AddOrUpdate(const FRecordKey& Key, const FRecordDefinition& Value, bool bVolatile = false, FNeoDataHandle* OutHandle = nullptr);
+	void Remove(const FRecordKey& Key);
+
+	/** Removes the entry at Index (from IndexOfKey/IndexOfStructKey), notifying the owner. */
+	void RemoveAt(int32 Index);
+
+	/**
+	 * Updates the entry at Index from raw value memory. A value of the entry's current type is copied into its
+	 * existing payload allocation. Same suppression, versioning and notification as AddOrUpdate.
+	 * @return true if the value changed.
+	 */
+	bool UpdateAtIndex(int32 Index, const UScriptStruct* ValueStruct, const void* ValueMemory, bool bVolatile = false);
+
+	/** Last version handed out on the authority. */
+	int64 GetLastVersion() const { return LastVersion; }
+
+	/** Client: every entry the server wrote at or below this version has been received, unless removed since. */
+	int64 GetReceivedVersion() const { return ReceivedVersion; }
+
+	/**
+	 * Client side: adds cached entries whose key is not present, keeping their replication ids so later
+	 * deltas from the server update them in place. No per-key notifications.
+	 * @return the number of entries added.
+	 */
+	int32 RestoreEntries(TArray<FNeoDataEntry>&& Entries);
+
+	/** Current version of Key, or 0 if absent. */
+	int64 GetVersion(const FRecordKey& Key) const
+	{
+		if (const FNeoDataTransactionShadow* Shadow = FindTransactionShadow(Key))
+		{
+			return Shadow->Value ? Shadow->Version : 0;
+		}
+		const int32 Index = IndexOfKey(Key);
+		return Index != INDEX_NONE ? Items[Index].Version : 0;
+	}
+
+	/** Tags entries written from now on with TransactionId (0 = none). */
+	void SetActiveTransaction(int32 TransactionId) { ActiveTransactionId = TransactionId; }
+	int32 GetActiveTransaction() const { return ActiveTransactionId; }
+
+	/**
+	 * Adds or updates many entries at once: storage and the key index are sized once, entries get their
+	 * replication ids directly and the array is marked dirty once. No per-key notifications.
+	 * Keys must already be normalized. Later duplicates of a key overwrite earlier ones.
+	 * @param OutAdded		If set, receives the Items index of each key the load added.
+	 * @param OutUpdated	If set, receives the Items index of each existing key whose value changed, once per key.
+	 * @return the number of entries added or changed.
+	 */
+	int32 BulkLoad(TArray<TPair<FRecordKey, FRecordDefinition>>&& Entries, TArray<int32>* OutAdded = nullptr, TArray<int32>* OutUpdated = nullptr);
+
+	/** Removes every present key in Keys with one array dirty mark. */
+	void RemoveBatch(TConstArrayView<FRecordKey> Keys);
+
+	/** Sets Key's expiry time (0 = never), dirtying the entry only if it changed. */
+	void SetExpireTime(const FRecordKey& Key, double ExpireTime);
+
+	/** Marks Key's entry Static with its value's content hash, dirtying it if that changed. Any later write clears it. */
+	void SetStatic(const FRecordKey& Key, uint64 StaticHash);
+
+	/** Re-sends Key through the fast array. Used to settle volatile entries once they stop changing. */
+	void MarkKeyDirty(const FRecordKey& Key);
+
+	/** Client side: applies an unreliable volatile update if it is newer than the held value. */
+	void ApplyVolatileUpdate(const FNeoVolatileUpdate& Update);
+
+	/** Key's value as readers see it: on clients, the value from before a transaction still being received. */
+	const FRecordDefinition* Find(const FRecordKey& Key) const;
+
+	/** Key's stored value, for writing. */
+	FRecordDefinition* Find(const FRecordKey& Key);
+
+	/** Keys readers see, manifests excluded. */
+	void GetKeys(TArray<FRecordKey>& OutKeys) const;
+
+	/**
+	 * Client: the shadow readers see instead of Key's entry while an incomplete transaction holds it back, or null.
+	 * Find, GetVersion, GetKeys and handles serve it, so a transaction becomes visible all at once when it is applied.
+	 */
+	const FNeoDataTransactionShadow* FindTransactionShadow(const FRecordKey& Key) const;
+	bool HasTransactionShadows() const { return !TransactionShadows.IsEmpty(); }
+
+	/** Client: ties the shadow of Key, removed in the current receive, to the transaction of the removal (0 = none). */
+	void AssignTransactionShadow(const FRecordKey& Key, int32 TransactionId) const;
+
+	/** Client: drops the shadows of every transaction IsPending rejects, and of unmatched removals. */
+	void ReleaseTransactionShadows(TFunctionRef<bool(int32)> IsPending) const;
+
+	/** Index of Key in Items, or INDEX_NONE. */
+	int32 IndexOfKey(const FRecordKey& Key) const;
+
+	/**
+	 * Index of Key's local default entry (bDefaultEntry) or of its replicated entry, or INDEX_NONE.
+	 * Clients can briefly hold both while a receive is in progress.
+	 */
+	int32 IndexOfKeyEntry(const FRecordKey& Key, bool bDefaultEntry) const;
+
+	/**
+	 * Adds Key with its baked default value as a local entry: no replication id, never written to a connection and
+	 * not counted in Digest, so server and clients hold it without traffic. Key must not be present. No notify.
+	 * @return index of the new entry.
+	 */
+	int32 AddDefaultEntry(const FRecordKey& Key, const FRecordDefinition& Value);
+
+	/**
+	 * Client: drops Key's local default entry without notifying, once a replicated entry or removal supersedes it.
+	 * With OutHandleSlot, its handle slot is detached into it instead of retired, for the entry that replaces it.
+	 */
+	bool RemoveDefaultEntry(const FRecordKey& Key, int32* OutHandleSlot = nullptr);
+
+	/**
+	 * Client: default keys whose replicated entry was added (false) or removed (true) in the current receive.
+	 * The owner reconciles them once the receive is complete.
+	 */
+	mutable TArray<TPair<FRecordKey, bool>> PendingDefaultKeys;
+
+	/** Client: handle slots detached from removed overrides of default keys, for the default entry that comes back. */
+	mutable TMap<FRecordKey, int32> PendingDefaultHandles;
+
+	/** Handle to the entry at Index, giving it a handle slot on first use. */
+	FNeoDataHandle GetHandle(int32 Index) const;
+
+	/** Handle to Key as readers see it, or an unset handle if they don't see the key. */
+	FNeoDataHandle FindHandle(const FRecordKey& Key) const;
+
+	/**
+	 * Index of the entry Handle refers to, or INDEX_NONE once it was removed.
+	 * O(1); falls back to one key lookup when replication has reordered Items since the handle was last resolved.
+	 */
+	int32 IndexOfHandle(const FNeoDataHandle& Handle) const;
+
+	const FRecordDefinition* Find(const FNeoDataHandle& Handle) const;
+
+	/** Retires the entry's handle slot; called as the entry leaves Items. */
+	void ReleaseHandle(const FNeoDataEntry& Entry) const;
+
+	/** Takes the entry's handle slot off it without retiring it, so another entry of the same key can carry it on. */
+	int32 DetachHandle(const FNeoDataEntry& Entry) const;
+
+	/** Gives the entry at Index a slot from DetachHandle; the slot is retired if the entry already has one. */
+	void AttachHandle(int32 Index, int32 HandleSlot) const;
+
+	/** Retires a detached handle slot: its handles stop resolving. */
+	void ReleaseHandleSlot(int32 HandleSlot) const;
+
+	/** Moves Entry's contribution in Digest to its current key and version. O(log buckets). */
+	void UpdateDigest(const FNeoDataEntry& Entry) const;
+
+	/** Takes Entry's contribution out of Digest; called as the entry leaves Items. */
+	void RemoveDigest(const FNeoDataEntry& Entry) const;
+
+	/** Recomputes Digest from every entry. */
+	void RebuildDigest() const;
+
+	/** Index of the Struct key whose data equals KeyMemory, without wrapping it in an FRecordKey. Must be canonical (not FGuid/FGameplayTag). */
+	int32 IndexOfStructKey(const UScriptStruct* KeyStruct, const void* KeyMemory) const;
+
+	// Array-level hook for FastArraySerializer
+	void PostReplicatedReceive(const FFastArraySerializer::FPostReplicatedReceiveParameters& Parameters);
+
+	/** Heap memory owned by the map: items, payloads, key index and shared payload cache. */
+	SIZE_T GetAllocatedSize() const;
+
+	/** Fills OutUsage with this map's memory, broken down per struct type. Walks every payload. */
+	void GetMemoryUsage(FNeoDataMemoryUsage& OutUsage) const;
+
+	/**
+	 * True if Items, the key hashes or the key index hold enough unused capacity to be worth releasing:
+	 * the map uses less than NeoData.CompactLoadFactor of it and the slack exceeds NeoData.CompactMinSlackBytes.
+	 */
+	bool NeedsCompaction() const;
+
+	/** Shrinks Items and the key hashes to fit and resizes or drops the key index. @return bytes released. */
+	int64 Compact();
+
+	/** Bytes Compact copies; the per-frame compaction budget is charged with this. */
+	int64 GetCompactionCost() const { return Items.Num() * static_cast<int64>(sizeof(FNeoDataEntry) + sizeof(uint32)); }
+
+	/** Marks the cached key hashes and index stale. Called when replication changes Items behind our back. */
+	void InvalidateKeyCache() const { bKeyHashesDirty = true; }
+
+private:
+	friend struct FNeoDataLookupBenchmark;
+	friend struct FNeoDataEntry;
+
+	/** Rebuilds KeyHashes (and drops the index) if replication changed Items since the last lookup. */
+	void RefreshKeyHashes() const;
+
+	/** Builds KeyIndex from KeyHashes if it is missing or its bucket count no longer fits. */
+	void RefreshKeyIndex() const;
+
+	/** Rebuilds KeyIndex with buckets and storage for Capacity entries. */
+	void BuildKeyIndex(int32 Capacity) const;
+
+	/** Vectorized scan of KeyHashes; used below the hash index threshold. */
+	int32 IndexOfKeyScan(const FRecordKey& Key, uint32 KeyHash) const;
+
+	/** Bucket lookup through KeyIndex; used for large maps. */
+	int32 IndexOfKeyIndexed(const FRecordKey& Key, uint32 KeyHash) const;
+
+	void RemoveAtIndex(int32 Index);
+
+	/** Takes a free handle slot, or adds one, for Key. */
+	int32 AllocateHandleSlot(const FRecordKey& Key) const;
+
+	/** Client: shadows Entry before NetSerialize replaces its value with one written by a transaction. */
+	void ShadowReceivedEntry(const FNeoDataEntry& Entry, int64 PreviousVersion) const;
+
+	/** Client: keeps Entry, removed in the current receive, in case its transaction is still incomplete. */
+	void ShadowRemovedEntry(const FNeoDataEntry& Entry) const;
+
+	/** Tells the owner that a write or removal replaces Entry outside the transaction that wrote it. */
+	void SupersedeTransaction(const FNeoDataEntry& Entry) const;
+
+	/**
+	 * Server: turns the override at Index back into a local default entry, in place so its handles stay valid.
+	 * The entry takes a local replication id, which deletes it from clients' fast arrays.
+	 */
+	void RevertToDefault(int32 Index, const FRecordDefinition& DefaultValue);
+
+	/** Asks the owner to compact once NeedsCompaction holds. Called after removals. */
+	void RequestCompactionIfNeeded();
+
+	/** Allocated bytes of Items, KeyHashes and KeyIndex; what compaction can release. */
+	int64 GetStorageAllocatedSize() const;
+
+	/**
+	 * GetTypeHash of each Items[i].Key, parallel to Items.
+	 * Maintained incrementally on the authority; rebuilt lazily on clients after replication.
+	 */
+	mutable TArray<uint32> KeyHashes;
+	mutable bool bKeyHashesDirty = false;
+
+	/** Hash -> Items index chains. Only built once the map reaches NeoData.HashIndexThreshold entries. */
+	mutable FHashTable KeyIndex;
+	mutable uint32 KeyIndexBuckets = 0;
+	mutable bool bKeyIndexValid = false;
+
+	int32 ActiveTransactionId = 0;
+
+	/** Handle slots, issued lazily by GetHandle. Released slots are reused with the next generation. */
+	mutable TArray<FNeoDataHandleSlot> HandleSlots;
+	mutable TArray<int32> FreeHandleSlots;
+
+	/** Last version handed out by a write on the authority. */
+	int64 LastVersion = 0;
+
+	/**
+	 * Client: contiguous version watermark. Each send carries the version of the base state it was diffed against
+	 * and of the state it produces; it only advances the watermark if its base is already covered, so sends applied
+	 * out of order after a lost packet never vouch for entries still missing.
+	 */
+	int64 ReceivedVersion = 0;
+
+	/** Client: by key, what readers see while incomplete transactions hold the key back. */
+	mutable TMap<FRecordKey, FNeoDataTransactionShadow> TransactionShadows;
+
+	/** Last replication id given to a local default entry; counts down from INDEX_NONE. */
+	int32 LastLocalID = INDEX_NONE;
+
+	/** True while NetDeltaSerialize writes to a connection that receives static entries as hashes. */
+	bool bWritingStaticStubs = false;
+
+	/** Fast array base state of the last replay checkpoint written; delta checkpoints are diffed against it. */
+	TSharedPtr<INetDeltaBaseState> CheckpointBaseState;
+
+	/** Filter of the resyncing connection being written to, during NetDeltaSerialize only. */
+	FNeoDataResyncFilter* ResyncFilter = nullptr;
+
+	/** Shared payload encodings by ReplicationID. Reset at the first NetDeltaSerialize of each frame. */
+	TMap<int32, FNeoSharedPayloadBits> SharedPayloads;
+	uint64 SharedPayloadsFrame = 0;
+};
+
+/**
+ * Trait to enable FastArraySerializer behavior
+ */
+template<>
+struct TStructOpsTypeTraits<FNeoDataMap> : TStructOpsTypeTraitsBase2<FNeoDataMap>
+{
+	enum
+	{
+		WithNetDeltaSerializer = true,
+	};
+};
+
+/**
+ * Client-side smoothing for numeric fields of one value struct.
+ */
+USTRUCT(BlueprintType)
+struct NEODATASYNC_API FNeoInterpolationRule
+{
+	GENERATED_BODY()
+
+	/** Value struct the rule applies to. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Data Sync")
+	const UScriptStruct* ValueType = nullptr;
+
+	/** Top-level float, double, vector, rotator, quat or color properties to smooth. Empty = all of them. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Data Sync")
+	TArray<FName> Properties;
+};
+
+/** Blend between the previously displayed and the latest replicated value of one key. */
+struct FNeoInterpolationState
+{
+	FInstancedStruct From;
+	FInstancedStruct To;
+	double StartTime = 0.0;
+	double Duration = 0.0;
+
+	/** Arrival time of the latest update, used to measure the replication interval. */
+	double LastUpdateTime = 0.0;
+};
+
+// Delegates
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnNeoDataKeyChanged, const FRecordKey&, Key, const FRecordDefinition&, Value);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnNeoDataKeyRemoved, const FRecordKey&, Key);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnNeoDataReset);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnNeoDataTransactionApplied, int32, TransactionId, const TArray<FRecordKey>&, Keys);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnNeoDataDigestVerified, bool, bWasInSync, int32, DivergentBuckets);
+
+/** Native per-key callback; see UNeoReplicatedDataComponent::WatchKey. */
+DECLARE_MULTICAST_DELEGATE_TwoParams(FOnNeoDataKeyWatched, const FRecordKey&, const FRecordDefinition&);
+
+/** A key notification held back until its transaction is complete. */
+struct FNeoDeferredNotify
+{
+	enum class EType : uint8 { Added, Updated, Removed };
+
+	EType Type = EType::Updated;
+	FRecordKey Key;
+	FRecordDefinition Value;
+	int32 TransactionId = 0;
+};
+
+/** Notifications of one transaction, held until all of its writes and removals are present. */
+struct FNeoPendingTransaction
+{
+	TArray<FNeoDeferredNotify> Notifies;
+
+	/** Written keys whose entry has not arrived with the transaction's id yet. */
+	TSet<FRecordKey> PendingWrites;
+
+	/** Removed keys whose removal has not arrived yet. */
+	TSet<FRecordKey> PendingRemovals;
+};
+
+/** Startup instrumentation of one component, aggregated by NeoData.LoadReport. */
+struct FNeoDataLoadTiming
+{
+	/** FPlatformTime::Seconds at OnRegister. */
+	double RegisterTime = 0.0;
+
+	/** Time spent in server write calls before the first send. */
+	double PopulateSeconds = 0.0;
+
+	bool bFirstSendRecorded = false;
+	bool bFirstReceiveRecorded = false;
+};
+
+/** Server side bookkeeping of an open transaction. */
+struct FNeoOpenTransaction
+{
+	int32 TransactionId = 0;
+	int32 Depth = 0;
+	TArray<FNeoDeferredNotify> Notifies;
+	TSet<FRecordKey> WrittenKeys;
+	TSet<FRecordKey> AddedKeys;
+	TSet<FRecordKey> RemovedKeys;
+};
+
+/**
+ * The Component container.
+ */
+UCLASS(BlueprintType, Blueprintable, ClassGroup=(Custom), meta=(BlueprintSpawnableComponent))
+class NEODATASYNC_API UNeoReplicatedDataComponent : public UActorComponent
+{
+	GENERATED_BODY()
+
+public:
+	UNeoReplicatedDataComponent();
+	virtual ~UNeoReplicatedDataComponent() override;
+
+	virtual void OnRegister() override;
+	virtual void OnUnregister() override;
+	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
+	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
+	virtual void GetResourceSizeEx(FResourceSizeEx& CumulativeResourceSize) override;
+
+	// The Map
+	UPROPERTY(Replicated)
+	FNeoDataMap DataMap;
+
+	// -------------------------------------------------------------------------
+	// Schema Enforcement
+	// -------------------------------------------------------------------------
+	
+	/** 
+	 * Optional: Restrict Keys to this specific Struct type. 
+	 * If set, SetData will ignore keys of other types.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "NeoData|Schema")
+	const UScriptStruct* RestrictedKeyType;
+
+	/** 
+	 * Optional: Restrict Values to this specific Struct type. 
+	 * If set, SetData will ignore values of other types.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "NeoData|Schema")
+	const UScriptStruct* RestrictedValueType;
+
+	// -------------------------------------------------------------------------
+	// Replication
+	// -------------------------------------------------------------------------
+
+	/**
+	 * If true, SetData with a value identical to the stored one (per the struct's Identical/operator==)
+	 * skips dirty marking and OnKeyUpdated. Disable to force a re-send and notify on every write.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "NeoData|Replication")
+	bool bSuppressIdenticalWrites = true;
+
+	/**
+	 * Seconds a volatile key must go without writes before it is re-sent once through the reliable fast array.
+	 * Guarantees clients converge on the final value even if the last unreliable update was dropped.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "NeoData|Replication", meta = (ClampMin = "0"))
+	float VolatileSettleDelay = 0.5f;
+
+	/** Width in seconds of the expiry wheel's finest slot; TTL entries expire at most this late. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "NeoData|Replication", meta = (ClampMin = "0.001"))
+	float ExpiryResolution = 0.1f;
+
+	/** Seconds a transaction's manifest entry stays in the map for late or split deliveries to complete against. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "NeoData|Replication", meta = (ClampMin = "0"))
+	float TransactionManifestLifetime = 2.0f;
+
+	/** Maximum volatile updates per unreliable RPC. Larger flushes are split to stay within a packet. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "NeoData|Replication", meta = (ClampMin = "1"))
+	int32 MaxVolatileUpdatesPerBatch = 32;
+
+	/**
+	 * Keeps a hash tree over the entries on server and clients so VerifyStateDigest can find and repair
+	 * divergence by exchanging a few node hashes instead of the whole map. Costs O(log DigestBuckets) per write.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "NeoData|Replication")
+	bool bEnableStateDigest = false;
+
+	/** Leaves of the state digest; rounded up to a power of two. More buckets mean fewer entries re-sent per divergence. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "NeoData|Replication", meta = (ClampMin = "16", ClampMax = "65536", EditCondition = "bEnableStateDigest"))
+	int32 DigestBuckets = 256;
+
+	/**
+	 * Clients keep the map when they disconnect, in UNeoDataReconnectCache. When they connect again, the server
+	 * sends only the entries written or removed since then, instead of the whole map.
+	 * The server holds the first send to the owning connection until the client reports its cache (one round
+	 * trip), or until ReconnectReportTimeout. Only the owning client can report, so other connections get the
+	 * full map. The server component must keep its state across the reconnect: for a PlayerState, copy DataMap
+	 * and StateEpoch in CopyProperties.
+	 * Each send then carries two version stamps, so server and client must agree on this setting. Replays never
+	 * carry them.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "NeoData|Replication")
+	bool bEnableReconnectResync = false;
+
+	/** Seconds the server waits for the client's cache report before sending the whole map. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "NeoData|Replication", meta = (ClampMin = "0", EditCondition = "bEnableReconnectResync"))
+	float ReconnectReportTimeout = 2.0f;
+
+	/** Removals remembered for reconnecting clients. A client away for more removals than this gets the whole map. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "NeoData|Replication", meta = (ClampMin = "1", EditCondition = "bEnableReconnectResync"))
+	int32 ReconnectTombstoneCapacity = 1024;
+
+	/**
+	 * Key of this component's state in the client's reconnect cache. None = the owning player's unique net id
+	 * plus the component name; components without an owning player are then not cached.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "NeoData|Replication", meta = (EditCondition = "bEnableReconnectResync"))
+	FName ReconnectCacheId;
+
+	/** Identifies the server map instance; clients' cached versions are only comparable within one epoch. */
+	UPROPERTY(Replicated, VisibleInstanceOnly, BlueprintReadOnly, Category = "NeoData|Replication")
+	FGuid StateEpoch;
+
+	/**
+	 * Baked default entries shipped with the client. The map starts with them on the server and on every client
+	 * without sending them; only keys the server writes to a different value, or removes, are replicated.
+	 * Loaded at register without per-key notifications, like BulkLoad.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "NeoData|Replication")
+	TObjectPtr<UNeoDataDefaultsAsset> DefaultsAsset;
+
+	// -------------------------------------------------------------------------
+	// Interpolation
+	// -------------------------------------------------------------------------
+
+	/**
+	 * Value fields that GetInterpolatedData smooths on clients. Each update blends from the currently
+	 * displayed value to the new one over the measured interval between updates, so the replication
+	 * rate can be lowered without visible stepping. The authority and GetData always see raw values.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "NeoData|Interpolation")
+	TArray<FNeoInterpolationRule> InterpolationRules;
+
+	/** Blend time for the first update of a key, and after a gap longer than MaxInterpolationDuration. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "NeoData|Interpolation", meta = (ClampMin = "0"))
+	float DefaultInterpolationDuration = 0.1f;
+
+	/** Longest measured interval treated as the replication rate rather than an idle gap. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "NeoData|Interpolation", meta = (ClampMin = "0"))
+	float MaxInterpolationDuration = 0.5f;
+
+	// -------------------------------------------------------------------------
+	// History
+	// -------------------------------------------------------------------------
+
+	/**
+	 * Number of past writes and removals kept for GetDataAtTime, across all keys. 0 disables history.
+	 * Each record stores only the payload's non-default properties.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "NeoData|History", meta = (ClampMin = "0"))
+	int32 HistoryCapacity = 0;
+
+	// -------------------------------------------------------------------------
+	// Blueprint API
+	// -------------------------------------------------------------------------
+
+	UFUNCTION(BlueprintCallable, BlueprintAuthorityOnly, Category = "NeoData")
+	void SetData(const FRecordKey& Key, const FRecordDefinition& Value);
+
+	/**
+	 * SetData for values that stay the same across sessions, such as item catalogs. The owning client receives
+	 * only a content hash and takes the value from its disk cache, asking the server only for values it lacks.
+	 * Other connections get the full value. Values holding hard object references are written as plain SetData.
+	 * While the owning client fetches a value, GetData there returns the previous value (empty for a new key) and
+	 * the key's notification, and its transaction's, wait for the value.
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintAuthorityOnly, Category = "NeoData")
+	void SetStaticData(const FRecordKey& Key, const FRecordDefinition& Value);
+
+	/**
+	 * Sets a high-frequency value (timers, progress bars) through the unreliable latest-value channel.
+	 * The first write adds the key reliably; later writes are batched into one unreliable multicast per tick,
+	 * and intermediate values may be skipped. A regular SetData on the key makes it reliable again.
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintAuthorityOnly, Category = "NeoData")
+	void SetVolatileData(const FRecordKey& Key, const FRecordDefinition& Value);
+
+	/**
+	 * Sets the value and schedules the key for removal after TimeToLive seconds.
+	 * Calling again refreshes the expiry; SetData updates the value and keeps the current expiry.
+	 * Expired keys are removed in one batch per tick and replicate as a single array update.
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintAuthorityOnly, Category = "NeoData")
+	void SetDataWithTTL(const FRecordKey& Key, const FRecordDefinition& Value, float TimeToLive);
+
+	UFUNCTION(BlueprintCallable, BlueprintAuthorityOnly, Category = "NeoData")
+	void RemoveData(const FRecordKey& Key);
+
+	/**
+	 * Populates the map in one pass, e.g. at server start. Schema is checked once per key/value type pair,
+	 * storage and the key index are sized once and the array is marked dirty once. Instead of per-key events
+	 * OnDataReset fires once; History and the change stream still get one Added or Updated record per key.
+	 * Not part of any open transaction.
+	 * @return the number of entries added or changed.
+	 */
+	int32 BulkLoad(TArray<TPair<FRecordKey, FRecordDefinition>>&& Entries);
+
+	/**
+	 * Writes Value only if Key is still at ExpectedVersion (0 = Key must not exist), for read-modify-write
+	 * without clobbering other systems. Read the version with GetVersion alongside GetData.
+	 * @param OutVersion	Key's version after the call: the new one on success, the current one on failure.
+	 * @return false if the entry changed since ExpectedVersion was read (or the value fails the schema).
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintAuthorityOnly, Category = "NeoData")
+	bool CompareAndSet(const FRecordKey& Key, int64 ExpectedVersion, const FRecordDefinition& Value, int64& OutVersion);
+
+	/**
+	 * Groups the following writes and removals into one transaction. Clients apply it once every part has arrived:
+	 * until then they keep reading the values from before it (GetData, GetKeys, handles), then its notifications
+	 * fire together, followed by OnTransactionApplied. Nested calls join the open transaction.
+	 * Volatile writes inside a transaction are sent reliably.
+	 * @return the transaction id.
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintAuthorityOnly, Category = "NeoData|Transaction")
+	int32 BeginTransaction();
+
+	/** Closes the innermost BeginTransaction; the outermost one publishes the transaction. */
+	UFUNCTION(BlueprintCallable, BlueprintAuthorityOnly, Category = "NeoData|Transaction")
+	void CommitTransaction();
+
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "NeoData")
+	bool GetData(const FRecordKey& Key, FRecordDefinition& OutValue) const;
+	
+	/** GetData with the fields named by InterpolationRules blended toward the latest replicated value. */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "NeoData")
+	bool GetInterpolatedData(const FRecordKey& Key, FRecordDefinition& OutValue) const;
+
+	/**
+	 * Key's value as of Time (server world time), rebuilt from the history ring.
+	 * False if the key was absent then, history is disabled, or Time is older than the key's retained history.
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "NeoData|History")
+	bool GetDataAtTime(const FRecordKey& Key, double Time, FRecordDefinition& OutValue) const;
+
+	/**
+	 * Native stream of every change this component applies or receives, for external consumers
+	 * (analytics, persistence). Records are only built while a consumer is attached. Game thread.
+	 */
+	FNeoDataChangeStream& GetChangeStream();
+
+	/**
+	 * Calls Callback whenever Key is added or updated, locally or by replication. Only the watchers of the
+	 * changed key run, so many waiters on different keys cost nothing per unrelated change.
+	 * Per-key notifications are skipped by BulkLoad and replay scrubs; watchers re-read the map on OnDataReset.
+	 */
+	FDelegateHandle WatchKey(const FRecordKey& Key, FOnNeoDataKeyWatched::FDelegate&& Callback);
+
+	/** Removes a WatchKey callback. Safe to call from inside the callback. */
+	void UnwatchKey(const FRecordKey& Key, FDelegateHandle Handle);
+
+	/** Native: fired when the component ends play, so waiters on it can give up instead of waiting forever. */
+	FSimpleMulticastDelegate OnComponentEndPlay;
+
+	/** Recorded changes, or null if HistoryCapacity is 0. */
+	const FNeoDataHistory* GetHistory() const { return History.Get(); }
+
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "NeoData")
+	TArray<FRecordKey> GetKeys() const;
+
+	/**
+	 * Key's version without copying its payload; 0 if absent. Changes exactly when the value does,
+	 * so polling code can compare it against the last version it saw.
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "NeoData")
+	int64 GetVersion(const FRecordKey& Key) const;
+
+	/** Handle to Key's entry for repeated O(1) access; unset if the key is absent. */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "NeoData|Handle")
+	FNeoDataHandle FindHandle(const FRecordKey& Key) const;
+
+	/** True while the entry Handle refers to still exists. */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "NeoData|Handle")
+	bool IsHandleValid(const FNeoDataHandle& Handle) const;
+
+	/** GetData through a handle: no key wrapping or hashing. False once the entry was removed. */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "NeoData|Handle")
+	bool GetDataByHandle(const FNeoDataHandle& Handle, FRecordDefinition& OutValue) const;
+
+	/** Get Data (Typed) through a handle: copies the stored value straight into Value. */
+	UFUNCTION(BlueprintCallable, CustomThunk, BlueprintPure, Category = "NeoData|Handle", meta = (CustomStructureParam = "Value", DisplayName = "Get Data By Handle (Typed)"))
+	bool GetStructDataByHandle(const FNeoDataHandle& Handle, int32& Value) const;
+	DECLARE_FUNCTION(execGetStructDataByHandle);
+
+	/** Seconds until Key expires, measured in server world time. False if the key is absent or has no TTL. */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "NeoData")
+	bool GetRemainingTTL(const FRecordKey& Key, float& OutSeconds) const;
+
+	/**
+	 * Releases unused map capacity now instead of waiting for the amortized policy.
+	 * @return bytes released.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "NeoData|Stats")
+	int64 CompactStorage();
+
+	/** Local write counters for this component's map. */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "NeoData|Stats")
+	FNeoDataMapStats GetStats() const;
+
+	/** Heap memory of this component's map and caches, per struct type. Walks every payload; meant for tooling. */
+	UFUNCTION(BlueprintCallable, Category = "NeoData|Stats")
+	FNeoDataMemoryUsage GetMemoryUsage() const;
+
+	// -------------------------------------------------------------------------
+	// Typed Blueprint API
+	// -------------------------------------------------------------------------
+
+	/**
+	 * SetData taking the key and value directly, without Make RecordKey or instanced struct nodes.
+	 * Key may be any struct, a Name, an integer or enum, a Guid, a Gameplay Tag or a RecordKey.
+	 * Updating an existing key copies the value into its stored payload without allocating.
+	 */
+	UFUNCTION(BlueprintCallable, CustomThunk, BlueprintAuthorityOnly, Category = "NeoData|Typed", meta = (CustomStructureParam = "Key,Value", DisplayName = "Set Data (Typed)"))
+	void SetStructData(const int32& Key, const int32& Value);
+	DECLARE_FUNCTION(execSetStructData);
+
+	/** GetData copying the stored value straight into Value. False if the key is absent or holds another type. */
+	UFUNCTION(BlueprintCallable, CustomThunk, BlueprintPure, Category = "NeoData|Typed", meta = (CustomStructureParam = "Key,Value", DisplayName = "Get Data (Typed)"))
+	bool GetStructData(const int32& Key, int32& Value) const;
+	DECLARE_FUNCTION(execGetStructData);
+
+	/** RemoveData taking the key directly. */
+	UFUNCTION(BlueprintCallable, CustomThunk, BlueprintAuthorityOnly, Category = "NeoData|Typed", meta = (CustomStructureParam = "Key", DisplayName = "Remove Data (Typed)"))
+	void RemoveStructData(const int32& Key);
+	DECLARE_FUNCTION(execRemoveStructData);
+
+	// -------------------------------------------------------------------------
+	// C++ Templated API
+	// -------------------------------------------------------------------------
+
+	/**
+	 * Strongly typed Set for C++.
+	 * Automatically wraps the key (FName, integer, FGuid, FGameplayTag or USTRUCT) and value struct.
+	 * Usage: MyComponent->SetTypedData(FName("HeroStats"), MyValueStruct);
+	 */
+	template <typename KeyT, typename ValueT>
+	void SetTypedData(const KeyT& InKey, const ValueT& InValue)
+	{
+		// Static checks to ensure we are passing valid UStructs
+		static_assert(TModels<CStaticStructProvider, ValueT>::Value, "ValueT must be a USTRUCT");
+
+		FRecordKey WrappedKey = FRecordKey::Make(InKey);
+		FRecordDefinition WrappedValue(FInstancedStruct::Make(InValue));
+
+		SetData(WrappedKey, WrappedValue);
+	}
+
+	/**
+	 * SetTypedData that also returns a handle to the entry, from the write's own lookup. Gives the entry a handle
+	 * slot, so use it for keys that are read back through the handle. Unset if the schema rejected the value.
+	 * Usage: HeroStatsHandle = MyComponent->SetTypedDataWithHandle(FName("HeroStats"), MyValueStruct);
+	 */
+	template <typename KeyT, typename ValueT>
+	FNeoDataHandle SetTypedDataWithHandle(const KeyT& InKey, const ValueT& InValue)
+	{
+		static_assert(TModels<CStaticStructProvider, ValueT>::Value, "ValueT must be a USTRUCT");
+
+		FNeoDataHandle Handle;
+		WriteData(FRecordKey::Make(InKey), FRecordDefinition(FInstancedStruct::Make(InValue)), &Handle);
+		return Handle;
+	}
+
+	/**
+	 * The stored value through a handle, in place; null if the entry was removed or holds another type.
+	 * Usage: if (const FMyValue* Val = MyComponent->GetTypedDataByHandle<FMyValue>(HeroStatsHandle)) { ... }
+	 */
+	template <typename ValueT>
+	const ValueT* GetTypedDataByHandle(const FNeoDataHandle& Handle) const
+	{
+		static_assert(TModels<CStaticStructProvider, ValueT>::Value, "ValueT must be a USTRUCT");
+
+		const FRecordDefinition* Found = DataMap.Find(Handle);
+		return Found ? Found->Payload.GetPtr<ValueT>() : nullptr;
+	}
+
+	/**
+	 * Strongly typed Get for C++.
+	 * Usage: 
+	 *    FMyValue Val;
+	 *    if (MyComponent->GetTypedData(FName("HeroStats"), Val)) { ... }
+	 */
+	template <typename KeyT, typename ValueT>
+	bool GetTypedData(const KeyT& InKey, ValueT& OutValue) const
+	{
+		static_assert(TModels<CStaticStructProvider, ValueT>::Value, "ValueT must be a USTRUCT");
+
+		// Read in place: no copy of the instanced payload
+		if (const FRecordDefinition* Found = DataMap.Find(FRecordKey::Make(InKey)))
+		{
+			if (const ValueT* Ptr = Found->Payload.GetPtr<ValueT>())
+			{
+				OutValue = *Ptr;
+				return true;
+			}
+		}
+		return false;
+	}
+
+	// Delegates
+	UPROPERTY(BlueprintAssignable, Category = "NeoData")
+	FOnNeoDataKeyChanged OnKeyAdded;
+
+	UPROPERTY(BlueprintAssignable, Category = "NeoData")
+	FOnNeoDataKeyChanged OnKeyUpdated;
+
+	UPROPERTY(BlueprintAssignable, Category = "NeoData")
+	FOnNeoDataKeyRemoved OnKeyRemoved;
+
+	/**
+	 * Fired once after a replay scrub or BulkLoad instead of per-key events: the map may have changed
+	 * arbitrarily, so listeners should re-read it.
+	 */
+	UPROPERTY(BlueprintAssignable, Category = "NeoData")
+	FOnNeoDataReset OnDataReset;
+
+	/** Fired after the per-key events of a transaction, with every key it wrote or removed. */
+	UPROPERTY(BlueprintAssignable, Category = "NeoData|Transaction")
+	FOnNeoDataTransactionApplied OnTransactionApplied;
+
+	/** Unreliable latest-value channel for volatile entries. */
+	UFUNCTION(NetMulticast, Unreliable)
+	void MulticastVolatileUpdates(const TArray<FNeoVolatileUpdate>& Updates);
+
+	/**
+	 * Client: compares this map's state digest with the server's and repairs what differs. Matching subtrees are
+	 * skipped, entries of divergent buckets are re-sent and entries the server no longer has are removed locally.
+	 * Needs bEnableStateDigest and an owning connection (server RPC). Completes with OnStateDigestVerified, which
+	 * reports not in sync if the server declined because checks came faster than NeoData.DigestMaxRequests allows.
+	 * @return false if the check could not start.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "NeoData|Replication")
+	bool VerifyStateDigest();
+
+	/** Fired on the client when a VerifyStateDigest round has finished. */
+	UPROPERTY(BlueprintAssignable, Category = "NeoData|Replication")
+	FOnNeoDataDigestVerified OnStateDigestVerified;
+
+	/** Client's hashes for Nodes of the state digest; the server answers with ClientDigestResponse. */
+	UFUNCTION(Server, Reliable)
+	void ServerCompareDigest(const TArray<int32>& Nodes, const TArray<uint64>& Hashes);
+
+	UFUNCTION(Client, Reliable)
+	void ClientDigestResponse(const FNeoDataDigestResponse& Response);
+
+	/** Client's cached epoch and version at connect; an invalid epoch means no cache. */
+	UFUNCTION(Server, Reliable)
+	void ServerReportCachedState(const FGuid& Epoch, int64 Version);
+
+	/** Static values the client is missing, by content hash. */
+	UFUNCTION(Server, Reliable)
+	void ServerRequestStaticEntries(const TArray<uint64>& Hashes);
+
+	UFUNCTION(Client, Reliable)
+	void ClientStaticEntries(const TArray<FNeoDataStaticPayload>& Payloads);
+
+	/** Called by DataMap: whether Connection receives static entries as hashes. Only the owning client can request values. */
+	bool CanSendStaticStubs(const UNetConnection* Connection) const;
+
+	/** Client: queues a static value request; FlushStaticRequests sends the queue at the end of the receive. */
+	void RequestStaticEntry(uint64 Hash) const { PendingStaticHashes.Add(Hash); }
+	void FlushStaticRequests();
+
+	/** Whether the reported cache was accepted, and the cached keys removed since its version. */
+	UFUNCTION(Client, Reliable)
+	void ClientReconnectResync(bool bDeltaAccepted, const TArray<FRecordKey>& RemovedKeys);
+
+	/**
+	 * Called by DataMap around each send. Fills Filter when Connection is resyncing after a reconnect.
+	 * @return false if the send is not filtered.
+	 */
+	bool BeginResyncSend(UNetConnection* Connection, bool bInitialSend, FNeoDataResyncFilter& OutFilter);
+	void EndResyncSend(UNetConnection* Connection, const FNetDeltaSerializeInfo& DeltaParms, const FNeoDataResyncFilter& Filter);
+
+	/**
+	 * Called by DataMap before each send. If a digest check of Connection found divergent entries, returns a copy of
+	 * OldState in which they were never sent, so the fast array re-sends them to that connection alone; else null.
+	 */
+	TSharedPtr<INetDeltaBaseState> TakeDigestRepairState(UNetConnection* Connection, const INetDeltaBaseState* OldState);
+
+	/** Called by DataMap when a key of DefaultsAsset is added or removed; the server tracks removed defaults for clients. */
+	void HandleDefaultKeyChanged(const FRecordKey& Key, bool bRemoved);
+
+	/**
+	 * Client: brings the local default entries of Keys in line with the replicated entries and RemovedDefaults,
+	 * notifying what changed. The bool is true when a replicated override of the key was removed, whose notify was held.
+	 */
+	void ReconcileDefaults(TConstArrayView<TPair<FRecordKey, bool>> Keys);
+
+	bool IsDefaultRemoved(const FRecordKey& Key) const { return RemovedDefaults.Contains(Key); }
+
+	// Internal hook for the struct to call back
+	void NotifyKeyAdded(const FRecordKey& Key, const FRecordDefinition& Value, int32 TransactionId = 0) const;
+	void NotifyKeyUpdated(const FRecordKey& Key, const FRecordDefinition& Value, int32 TransactionId = 0) const;
+	void NotifyKeyRemoved(const FRecordKey& Key) const;
+
+	/** Called by DataMap with the duration and size of each NetDeltaSerialize until the first send and receive are recorded. */
+	void RecordNetDeltaSerialize(bool bReading, double Seconds, int64 Bytes);
+	bool NeedsLoadTiming(bool bReading) const { return bReading ? !LoadTiming.bFirstReceiveRecorded : !LoadTiming.bFirstSendRecorded; }
+
+	/**
+	 * Called by DataMap when a write or removal replaces an entry written by transaction TransactionId.
+	 * The server drops Key from that transaction's manifest, if it has not expired.
+	 */
+	void SupersedeTransactionWrite(int32 TransactionId, const FRecordKey& Key);
+
+	/** Called by DataMap when Key is added again; the server drops it from the manifest of the transaction that removed it. */
+	void SupersedeTransactionRemoval(const FRecordKey& Key);
+
+	/** Called by DataMap when removals left it sparse; compaction runs on a later tick within the frame budget. */
+	void RequestCompaction();
+
+	/** Client side: notifications during a fast array receive are queued and sorted into transactions at the end. */
+	void BeginReplicatedReceive() const { bReceiving = true; }
+	void EndReplicatedReceive() const;
+
+	/** True while a replay loads a checkpoint or fast-forwards to the scrub target. */
+	bool IsApplyingReplayScrub() const;
+
+private:
+	/** Checks RestrictedKeyType/RestrictedValueType, logging Context on failure. */
+	bool PassesSchema(const FRecordKey& Key, const FRecordDefinition& Value, const TCHAR* Context) const;
+	bool PassesSchema(const UScriptStruct* KeyStruct, ENeoRecordKeyKind KeyKind, const UScriptStruct* ValueStruct, const TCHAR* Context) const;
+
+	/** Body of SetData; OutHandle, if set, receives a handle to the written entry. */
+	void WriteData(const FRecordKey& InKey, const FRecordDefinition& Value, FNeoDataHandle* OutHandle);
+
+	/** Bodies of the typed Blueprint thunks; keys and values arrive as property memory. */
+	void SetDataFromMemory(const FProperty* KeyProperty, const void* KeyMemory, const UScriptStruct* ValueStruct, const void* ValueMemory);
+	bool GetDataToMemory(const FProperty* KeyProperty, const void* KeyMemory, const UScriptStruct* ValueStruct, void* OutValueMemory) const;
+	void RemoveDataFromMemory(const FProperty* KeyProperty, const void* KeyMemory);
+
+	/** Compacts DataMap if it still needs it and this frame's compaction budget allows. */
+	void RunPendingCompaction();
+
+	/** Ticks only while there is deferred work (volatile flushes and settles, pending expiries, compaction). */
+	void UpdateTickEnabled();
+
+	/** Server world time; the time base for entry expiry on both server and clients. */
+	double GetServerWorldTime() const;
+
+	/** Pops due timers and removes their entries in one batch. */
+	void ExpireEntries(double Now);
+
+	/** Sets Key's replicated expiry and schedules its removal on the wheel. */
+	void ScheduleExpiry(const FRecordKey& Key, double ExpireTime);
+
+	void FlushVolatileUpdates();
+	void SettleVolatileKeys(double Now);
+
+	/** Volatile keys written since the last flush. */
+	TSet<FRecordKey> PendingVolatileKeys;
+
+	/** Volatile keys awaiting their reliable settle, with the time of their last write. */
+	TMap<FRecordKey, double> VolatileLastWriteTimes;
+
+	/** Created on the first SetDataWithTTL. */
+	TUniquePtr<FNeoExpiryWheel> ExpiryWheel;
+
+	void HandleReplayScrubComplete(UWorld* InWorld);
+
+	/** Routes a notification: held for a transaction, queued during a receive, or dispatched now. */
+	void DeferOrDispatch(FNeoDeferredNotify&& Notify) const;
+
+	/** Interpolation, history and delegates for one key notification. Value is null for removals. */
+	void DispatchNotify(FNeoDeferredNotify::EType Type, const FRecordKey& Key, const FRecordDefinition* Value) const;
+
+	/** Dispatches a transaction's held notifications, then OnTransactionApplied. */
+	void DispatchTransaction(int32 TransactionId, const TArray<FNeoDeferredNotify>& Notifies) const;
+
+	/** True once every write and removal of the transaction has arrived, or its manifest expired. */
+	bool IsTransactionComplete(int32 TransactionId, const FNeoPendingTransaction& Transaction) const;
+
+	/** Client: whether a notification arriving in a receive must wait for EndReplicatedReceive, which may assign it to a transaction. */
+	bool IsHeldDuringReceive(FNeoDeferredNotify::EType Type, const FRecordKey& Key, int32 TransactionId) const;
+
+	FNeoDataLoadTiming LoadTiming;
+
+	/** Server: the transaction between BeginTransaction and the matching CommitTransaction. */
+	mutable TOptional<FNeoOpenTransaction> OpenTransaction;
+	int32 LastTransactionId = 0;
+
+	/** Server: the transaction whose manifest lists each key as removed, until the key is added again or the manifest expires. */
+	TMap<FRecordKey, int32> TransactionRemovals;
+
+	/** Client: transactions whose manifest arrived but which are still missing parts. */
+	mutable TMap<int32, FNeoPendingTransaction> PendingTransactions;
+	mutable TArray<FNeoDeferredNotify> ReceiveQueue;
+	mutable bool bReceiving = false;
+
+	FDelegateHandle ReplayScrubCompleteHandle;
+
+	bool bCompactionPending = false;
+
+	/** Set when per-key notifies were skipped during a scrub; OnDataReset fires when it completes. */
+	mutable bool bReplayScrubPending = false;
+
+	/** Created on the first GetChangeStream. */
+	TUniquePtr<FNeoDataChangeStream> ChangeStream;
+
+	/** Created on register when bEnableStateDigest is set; DataMap keeps it current. */
+	TUniquePtr<FNeoDataDigest> Digest;
+
+	/** Client: buckets found divergent so far in the current VerifyStateDigest. */
+	int32 DigestRoundBuckets = 0;
+
+	/** Server: per connection that requested a digest comparison. */
+	TMap<TObjectKey<UNetConnection>, FNeoDataDigestRepair> DigestRepairs;
+
+	/** Client: static values to request at the end of the current receive. */
+	mutable TSet<uint64> PendingStaticHashes;
+
+	/** Server: created on the first send when bEnableReconnectResync is set. */
+	TUniquePtr<FNeoDataReconnect> Reconnect;
+
+	/** Key of this component in UNeoDataReconnectCache, or empty if it cannot be cached. */
+	FString GetReconnectCacheId() const;
+
+	/** Fills DefaultValues from DefaultsAsset once and adds a local default entry for each key not present. */
+	void LoadDefaults();
+
+	/** DefaultsAsset's entries by normalized key; DataMap.Defaults points here. */
+	TMap<FRecordKey, FRecordDefinition> DefaultValues;
+
+	/** Keys of DefaultsAsset the server removed; clients drop their local default entry for these. */
+	UPROPERTY(ReplicatedUsing = OnRep_RemovedDefaults)
+	TArray<FRecordKey> RemovedDefaults;
+
+	/** Server's DefaultsAsset ContentHash, so clients can detect a different cook. */
+	UPROPERTY(ReplicatedUsing = OnRep_DefaultsHash)
+	uint64 DefaultsHash = 0;
+
+	UFUNCTION()
+	void OnRep_RemovedDefaults(const TArray<FRecordKey>& PreviousRemovedDefaults);
+
+	UFUNCTION()
+	void OnRep_DefaultsHash();
+
+	/** WatchKey callbacks by normalized key. Shared so a callback can unwatch while its list is broadcasting. */
+	TMap<FRecordKey, TSharedPtr<FOnNeoDataKeyWatched>> KeyWatchers;
+
+	/** Created on register when HistoryCapacity > 0. Fed from the Notify hooks, so it sees local and replicated changes. */
+	TUniquePtr<FNeoDataHistory> History;
+
+	/** Resolved InterpolationRules properties for ValueStruct, or null if it has none. */
+	const TArray<const FProperty*>* FindInterpolatedProperties(const UScriptStruct* ValueStruct) const;
+
+	/** Starts a blend from the displayed value to Value. Called for replicated adds and changes on clients. */
+	void UpdateInterpolation(const FRecordKey& Key, const FRecordDefinition& Value) const;
+
+	/** Writes State's blend at Now over Properties into Out, which must hold a copy of State.To. */
+	static void EvaluateInterpolation(const FNeoInterpolationState& State, TConstArrayView<const FProperty*> Properties,
+		double Now, FInstancedStruct& Out);
+
+	/** Per-key blends; only keys whose value struct has interpolated properties. Display state, hence mutable. */
+	mutable TMap<FRecordKey, FNeoInterpolationState> Interpolations;
+	mutable TMap<TObjectKey<UScriptStruct>, TArray<const FProperty*>> InterpolatedPropertyCache;
+};